@@ -0,0 +1,295 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "BasicPID.hpp"
+#include "ControllerGraph.hpp"
+#include "FixedPoint.hpp"
+#include "MockSensor.hpp"
+#include "PID.hpp"
+#include "PIDBatch.hpp"
+#include "PIDT.hpp"
+#include "Plant.hpp"
+#include "ReplaySensor.hpp"
+#include "Simulation.hpp"
+#include "SwarmSimulation.hpp"
+#include "Telemetry.hpp"
+
+namespace
+{
+    // Reports throughput as steps/s and time per step (printed with an SI prefix, e.g. 38ns)
+    void setStepCounters(benchmark::State &state, double steps_per_iteration)
+    {
+        double total = steps_per_iteration * state.iterations();
+        state.counters["steps/s"] = benchmark::Counter(total, benchmark::Counter::kIsRate);
+        state.counters["time/step"] = benchmark::Counter(total, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    }
+}
+
+// --- Building blocks ---
+
+static void BM_PIDCalculate(benchmark::State &state)
+{
+    PID pid(0.6, 0.01, 0.05, 0.1, 500.0, -500.0);
+    double pv = 0.0;
+    for (auto _ : state)
+    {
+        double out = pid.calculate(100.0, pv);
+        pv += out * 1e-3;
+        benchmark::DoNotOptimize(out);
+    }
+    setStepCounters(state, 1);
+}
+BENCHMARK(BM_PIDCalculate);
+
+namespace
+{
+    struct AltitudeHold
+    {
+        static constexpr double kp = 0.6, ki = 0.01, kd = 0.05;
+        static constexpr double dt = 0.1, max_output = 500.0, min_output = -500.0;
+    };
+}
+
+template <typename T>
+static void BM_PIDTCalculate(benchmark::State &state)
+{
+    PIDT<AltitudeHold, T> pid;
+    T pv = T(0);
+    for (auto _ : state)
+    {
+        T out = pid.calculate(T(100), pv);
+        pv += out * T(1e-3);
+        benchmark::DoNotOptimize(out);
+    }
+    setStepCounters(state, 1);
+}
+BENCHMARK_TEMPLATE(BM_PIDTCalculate, double);
+BENCHMARK_TEMPLATE(BM_PIDTCalculate, float);
+BENCHMARK_TEMPLATE(BM_PIDTCalculate, Q16_16);
+
+// Runtime gains in the controller's native type (no conversion at the boundary)
+template <typename T>
+static void BM_BasicPIDStep(benchmark::State &state)
+{
+    BasicPID<T> pid(0.6, 0.01, 0.05, 0.1, 500.0, -500.0);
+    T pv = T(0.0);
+    for (auto _ : state)
+    {
+        T out = pid.step(T(100.0), pv);
+        pv += out * T(1e-3);
+        benchmark::DoNotOptimize(out);
+    }
+    setStepCounters(state, 1);
+}
+BENCHMARK_TEMPLATE(BM_BasicPIDStep, double);
+BENCHMARK_TEMPLATE(BM_BasicPIDStep, float);
+BENCHMARK_TEMPLATE(BM_BasicPIDStep, Q16_16);
+
+static void BM_PIDBatchCalculate(benchmark::State &state)
+{
+    const std::size_t lanes = state.range(0);
+    PIDBatch batch(lanes, 0.1, 500.0, -500.0);
+    for (std::size_t i = 0; i < lanes; i++)
+        batch.setGains(i, 0.6, 0.01, 0.05);
+    std::vector<double> setpoint(lanes, 100.0), pv(lanes, 0.0), out(lanes);
+
+    for (auto _ : state)
+    {
+        batch.calculate(setpoint.data(), pv.data(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    setStepCounters(state, static_cast<double>(lanes)); // One "step" per controller
+}
+BENCHMARK(BM_PIDBatchCalculate)->Arg(8)->Arg(64)->Arg(1024);
+
+// N parallel PID stages in one flattened graph (cost should grow linearly with N)
+static void BM_ControllerGraphStep(benchmark::State &state)
+{
+    const int loops = static_cast<int>(state.range(0));
+    ControllerGraph graph(0.1);
+    for (int l = 0; l < loops; l++)
+    {
+        Signal sp = graph.input("sp");
+        Signal pv = graph.input("pv");
+        graph.set(sp, 100.0);
+        graph.output("u", graph.pid(sp, pv, {0.6, 0.01, 0.05, 500.0, -500.0}));
+    }
+    graph.compile();
+
+    for (auto _ : state)
+    {
+        graph.step();
+        benchmark::DoNotOptimize(graph.value(0));
+    }
+    setStepCounters(state, loops); // One "step" per stage
+}
+BENCHMARK(BM_ControllerGraphStep)->Arg(1)->Arg(8)->Arg(64);
+
+// Runtime-configured path: the loop only knows an ISensor
+static void BM_MockSensorRead(benchmark::State &state)
+{
+    MockSensor sensor(0.0);
+    ISensor &dynamic = sensor;
+    benchmark::DoNotOptimize(&dynamic);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(dynamic.readValue());
+    setStepCounters(state, 1);
+}
+BENCHMARK(BM_MockSensorRead);
+
+// Static path: SensorBase::read() inlines MockSensor::sample()
+static void BM_MockSensorReadStatic(benchmark::State &state)
+{
+    MockSensor sensor(0.0);
+    SensorBase<MockSensor> &fixed = sensor;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(fixed.read());
+    setStepCounters(state, 1);
+}
+BENCHMARK(BM_MockSensorReadStatic);
+
+// Burst path: one call per chunk of samples
+static void BM_MockSensorReadBatch(benchmark::State &state)
+{
+    const std::size_t chunk = state.range(0);
+    MockSensor sensor(0.0);
+    std::vector<double> values(chunk), stamps(chunk);
+    for (auto _ : state)
+    {
+        sensor.readBatch(values.data(), stamps.data(), chunk);
+        benchmark::DoNotOptimize(values.data());
+    }
+    setStepCounters(state, static_cast<double>(chunk));
+}
+BENCHMARK(BM_MockSensorReadBatch)->Arg(64)->Arg(1024);
+
+// Vehicle physics for many lanes at once (arg 1: 0 = semi-implicit Euler, 1 = RK4)
+static void BM_PlantBatchStep(benchmark::State &state)
+{
+    const std::size_t lanes = state.range(0);
+    PlantConfig config;
+    config.type = PlantType::Vehicle;
+    config.integrator = state.range(1) ? IntegratorMethod::RK4 : IntegratorMethod::SemiImplicitEuler;
+    PlantBatch plant(lanes, config, 10.0);
+    std::vector<double> command(lanes, 5.0);
+
+    for (auto _ : state)
+    {
+        plant.step(command.data(), 0.1);
+        benchmark::DoNotOptimize(plant.altitude());
+    }
+    setStepCounters(state, static_cast<double>(lanes));
+}
+BENCHMARK(BM_PlantBatchStep)->Args({64, 0})->Args({64, 1})->Args({1024, 0})->Args({1024, 1});
+
+// --- Full loop (same as main.cpp without telemetry output) ---
+
+static void BM_SimulationLoop(benchmark::State &state)
+{
+    MissionProfile mission;
+    mission.steps = static_cast<int>(state.range(0));
+    mission.switch_step = mission.steps / 2;
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(simulateMetrics({0.6, 0.01, 0.05}, mission));
+    setStepCounters(state, mission.steps);
+}
+BENCHMARK(BM_SimulationLoop)->Arg(1000)->Arg(10000)->Arg(100000);
+
+// Same loop flying the vehicle plant with RK4
+static void BM_SimulationLoopVehicle(benchmark::State &state)
+{
+    MissionProfile mission;
+    mission.steps = static_cast<int>(state.range(0));
+    mission.switch_step = mission.steps / 2;
+    mission.plant.type = PlantType::Vehicle;
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(simulateMetrics({8.0, 0.05, 25.0}, mission));
+    setStepCounters(state, mission.steps);
+}
+BENCHMARK(BM_SimulationLoopVehicle)->Arg(10000);
+
+// Swarm: vehicles x 3 axes in SoA lanes, single thread
+static void BM_SwarmSimulation(benchmark::State &state)
+{
+    SwarmConfig config;
+    config.vehicles = static_cast<int>(state.range(0));
+    config.axes = 3;
+    config.mission.steps = 1000;
+    for (auto _ : state)
+    {
+        SwarmSimulation swarm(config);
+        swarm.run();
+        benchmark::DoNotOptimize(swarm.metrics().data());
+    }
+    setStepCounters(state, static_cast<double>(config.vehicles) * config.axes * config.mission.steps);
+}
+BENCHMARK(BM_SwarmSimulation)->Arg(10)->Arg(100)->UseRealTime(); // Work runs on pool threads
+
+// --- Telemetry output ---
+
+static void writeTelemetry(TelemetryWriter &writer, int steps)
+{
+    for (int i = 0; i < steps; i++)
+        writer.write({i * 0.1, 100.0, 99.5 + i * 1e-3, 12.25 - i * 1e-4});
+    writer.close();
+}
+
+static void BM_TelemetryCsv(benchmark::State &state)
+{
+    const int steps = static_cast<int>(state.range(0));
+    for (auto _ : state)
+    {
+        CsvTelemetryWriter writer("bench_telemetry.csv");
+        writeTelemetry(writer, steps);
+    }
+    setStepCounters(state, steps);
+    std::remove("bench_telemetry.csv");
+}
+BENCHMARK(BM_TelemetryCsv)->Arg(1000)->Arg(100000);
+
+static void BM_TelemetryBinary(benchmark::State &state)
+{
+    const int steps = static_cast<int>(state.range(0));
+    const TelemetryPrecision precision = state.range(1) == 32 ? TelemetryPrecision::Float32 : TelemetryPrecision::Float64;
+    for (auto _ : state)
+    {
+        BinaryTelemetryWriter writer("bench_telemetry.bin", 0.1, steps, precision);
+        writeTelemetry(writer, steps);
+    }
+    setStepCounters(state, steps);
+    std::remove("bench_telemetry.bin");
+}
+BENCHMARK(BM_TelemetryBinary)->Args({1000, 64})->Args({100000, 64})->Args({100000, 32});
+
+// Replays a recording through PID: 0 = CSV, 32 / 64 = binary precision
+static void BM_ReplayPID(benchmark::State &state)
+{
+    const int steps = 100000;
+    const std::string path = state.range(0) == 0 ? "bench_replay.csv" : "bench_replay.bin";
+    {
+        std::unique_ptr<TelemetryWriter> writer;
+        if (state.range(0) == 0)
+            writer = std::make_unique<CsvTelemetryWriter>(path);
+        else
+            writer = std::make_unique<BinaryTelemetryWriter>(
+                path, 0.1, steps, state.range(0) == 32 ? TelemetryPrecision::Float32 : TelemetryPrecision::Float64);
+        writeTelemetry(*writer, steps);
+    }
+
+    ReplaySensor sensor(path);
+    PID pid(0.6, 0.01, 0.05, 0.1, 500.0, -500.0);
+    for (auto _ : state)
+    {
+        ReplayReport report = replayController(pid, sensor, 1e9);
+        benchmark::DoNotOptimize(report);
+    }
+    setStepCounters(state, steps);
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ReplayPID)->Arg(0)->Arg(32)->Arg(64);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,58 @@
+#pragma once
+#include <algorithm> // for std::clamp (C++17)
+
+// Runtime-gain PID in an arbitrary arithmetic type: double, float or a
+// Q-format Fixed (FixedPoint.hpp), for targets where double is emulated.
+// Uses the same folded form as PIDT (ki * dt and kd / dt are precomputed in
+// double and then converted), so step() has no division and no conversion.
+//
+// step() works in T throughout. calculate() is the controller interface
+// (Controller.hpp): it converts the double reading to T and the command back,
+// like the ADC and DAC around a flight computer, so BasicPID<T> runs in the
+// same templated loops as PID.
+template <typename T>
+class BasicPID
+{
+public:
+    using value_type = T;
+
+    BasicPID(double kp, double ki, double kd, double dt, double max_output, double min_output)
+        : _kp(kp), _ki_dt(ki * dt), _kd_inv_dt(kd / dt), _max(max_output), _min(min_output), _i_term(0.0),
+          _pre_error(0.0)
+    {
+    }
+
+    T step(T setpoint, T pv)
+    {
+        // 1. Calculate Error
+        T error = setpoint - pv;
+
+        // 2. Integral Term (ki * dt folded into the accumulator)
+        _i_term += _ki_dt * error;
+
+        // 3. Derivative Term (kd / dt precomputed)
+        T derivative = _kd_inv_dt * (error - _pre_error);
+        _pre_error = error;
+
+        // 4. Total, clamped to hardware limits (Safety!)
+        return std::clamp(_kp * error + _i_term + derivative, _min, _max);
+    }
+
+    double calculate(double setpoint, double pv) { return static_cast<double>(step(T(setpoint), T(pv))); }
+
+    void reset()
+    {
+        _i_term = T(0.0);
+        _pre_error = T(0.0);
+    }
+
+private:
+    T _kp;
+    T _ki_dt;
+    T _kd_inv_dt;
+    T _max;
+    T _min;
+
+    T _i_term;    // ki * accumulated (error * dt)
+    T _pre_error; // Previous error for Derivative term
+};
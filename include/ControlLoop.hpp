@@ -0,0 +1,99 @@
+#pragma once
+#include "Controller.hpp"
+#include "Metrics.hpp"
+#include "Mission.hpp"
+#include "MockSensor.hpp"
+#include "Plant.hpp"
+#include "RunLimits.hpp"
+#include "SensorBase.hpp"
+
+// The mission loop from main.cpp as a template, so any controller type
+// (runtime PID or compile-time PIDT) and any static sensor can be plugged in
+// with zero virtual calls. The sensor also stands in for the physics, so it
+// needs update(step_value) like MockSensor.
+template <typename Controller, typename Sensor>
+MetricsSummary runControlLoop(Controller &controller, SensorBase<Sensor> &sensor, const MissionProfile &mission)
+{
+    static_assert(is_controller_v<Controller>, "Controller needs calculate(setpoint, pv) and reset()");
+
+    Sensor &altimeter = static_cast<Sensor &>(sensor);
+    Metrics metrics(mission);
+
+    for (int i = 0; i < mission.steps; i++)
+    {
+        double current_target = mission.targetAt(i);
+
+        double current_alt = altimeter.read();
+        double motor_power = controller.calculate(current_target, current_alt);
+        altimeter.update(motor_power * mission.dt);
+
+        metrics.update(i, current_target, current_alt);
+    }
+
+    return metrics.summary();
+}
+
+// Same loop, but a Plant (see Plant.hpp) integrates the command and the
+// sensor reads the plant's altitude through setValue(value)
+template <typename Controller, typename Sensor, typename PlantModel>
+MetricsSummary runControlLoop(Controller &controller, SensorBase<Sensor> &sensor, PlantModel &plant,
+                              const MissionProfile &mission)
+{
+    static_assert(is_controller_v<Controller>, "Controller needs calculate(setpoint, pv) and reset()");
+
+    Sensor &altimeter = static_cast<Sensor &>(sensor);
+    Metrics metrics(mission);
+
+    for (int i = 0; i < mission.steps; i++)
+    {
+        double current_target = mission.targetAt(i);
+
+        double current_alt = altimeter.read();
+        double motor_power = controller.calculate(current_target, current_alt);
+        plant.step(motor_power, mission.dt);
+        altimeter.setValue(plant.altitude());
+
+        metrics.update(i, current_target, current_alt);
+    }
+
+    return metrics.summary();
+}
+
+// Plant-driven loop, stopping early when RunLimits say the run is lost
+template <typename Controller, typename Sensor, typename PlantModel>
+RunResult runControlLoopBounded(Controller &controller, SensorBase<Sensor> &sensor, PlantModel &plant,
+                                const MissionProfile &mission, const RunLimits &limits)
+{
+    static_assert(is_controller_v<Controller>, "Controller needs calculate(setpoint, pv) and reset()");
+
+    Sensor &altimeter = static_cast<Sensor &>(sensor);
+    Metrics metrics(mission);
+    RunMonitor monitor(limits, mission);
+
+    for (int i = 0; i < mission.steps; i++)
+    {
+        double current_target = mission.targetAt(i);
+
+        double current_alt = altimeter.read();
+        double motor_power = controller.calculate(current_target, current_alt);
+        plant.step(motor_power, mission.dt);
+        altimeter.setValue(plant.altitude());
+
+        metrics.update(i, current_target, current_alt);
+
+        RunStatus status = monitor.check(metrics, current_target, current_alt, motor_power);
+        if (status != RunStatus::Completed)
+            return {metrics.summary(), status, i + 1};
+    }
+
+    return {metrics.summary(), RunStatus::Completed, mission.steps};
+}
+
+// Same loop with the mission's own MockSensor and plant
+template <typename Controller>
+MetricsSummary runControlLoop(Controller &controller, const MissionProfile &mission)
+{
+    MockSensor altimeter(mission.initial_altitude, mission.noise);
+    return withPlant(mission.plant, mission.initial_altitude,
+                     [&](auto &plant) { return runControlLoop(controller, altimeter, plant, mission); });
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <type_traits>
+#include <utility>
+
+// The controller "concept" shared by PID, PIDT and friends (C++17 detection idiom):
+// anything with calculate(setpoint, pv) returning a number, and reset().
+template <typename C, typename = void>
+struct is_controller : std::false_type
+{
+};
+
+template <typename C>
+struct is_controller<C, std::void_t<decltype(std::declval<C &>().calculate(0.0, 0.0)),
+                                    decltype(std::declval<C &>().reset())>>
+    : std::is_arithmetic<decltype(std::declval<C &>().calculate(0.0, 0.0))>
+{
+};
+
+template <typename C>
+constexpr bool is_controller_v = is_controller<C>::value;
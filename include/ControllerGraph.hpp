@@ -0,0 +1,146 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#include "PID.hpp"
+
+// Multi-loop controller built from PID stages, filters, feed-forward and
+// limiters, e.g. an altitude -> velocity -> thrust cascade or several
+// attitude loops side by side.
+//
+// Stages are wired by Signal handles while the graph is built. compile() then
+// drops stages that no output depends on and flattens the rest into one
+// contiguous schedule: a POD op array plus one array holding every stage's
+// parameters and state next to each other. step() walks that schedule with a
+// switch: no virtual calls, no allocation, no pointer chasing. A stage can
+// only read signals that existed when it was added, so creation order is
+// already a valid execution order and feedback loops cannot be built.
+//
+//   ControllerGraph g(0.1);
+//   Signal sp = g.input("altitude_sp"), alt = g.input("altitude");
+//   Signal vel_sp = g.pid(sp, alt, {1.0, 0.0, 0.0, 5.0, -5.0});
+//   Signal vel = g.lowPass(g.derivative(alt), 0.3);
+//   g.output("thrust", g.pid(vel_sp, vel, {40.0, 2.0, 0.0, 500.0, -500.0}));
+//   g.compile();
+//   g.set(sp, 50.0); g.set(alt, reading); g.step(); double u = g.value(0);
+using Signal = std::uint32_t;
+
+// One PID stage. It runs PIDLaw, the same arithmetic as PID::calculate, so a
+// stage with the same gains, limits and options is bit-identical to PID.
+struct PIDStage
+{
+    double kp;
+    double ki;
+    double kd;
+    double max_output;
+    double min_output;
+    PIDOptions options = {};
+};
+
+class ControllerGraph
+{
+public:
+    explicit ControllerGraph(double dt);
+
+    // --- Building (before compile) ---
+
+    // External value, written with set() before each step()
+    Signal input(const std::string &name);
+    Signal constant(double value);
+
+    Signal pid(Signal setpoint, Signal pv, const PIDStage &stage);
+    Signal lowPass(Signal in, double time_constant); // First order, starts at its first input
+    Signal derivative(Signal in);                    // Backward difference, 0 on the first step
+    Signal gain(Signal in, double k);
+    Signal sum(Signal a, Signal b, double k = 1.0); // a + k * b (feed-forward)
+    Signal clamp(Signal in, double lo, double hi);
+
+    // Marks a signal as a result; value(index) / outputs are in the order added
+    void output(const std::string &name, Signal s);
+
+    // Flattens the graph into the execution schedule. Throws std::logic_error
+    // if there is no output or the graph was already compiled.
+    void compile();
+
+    // --- Running (after compile) ---
+
+    void set(Signal in, double value) { _signals[in] = value; }
+    void step();
+    double value(std::size_t output) const { return _signals[_outputs[output]]; }
+    double signal(Signal s) const { return _signals[s]; }
+
+    // Clears every stage's state (integrators, filters, previous values)
+    void reset();
+
+    // Controller concept (see Controller.hpp): the first two inputs are the
+    // setpoint and the measurement, the first output is the command. Throws
+    // std::logic_error if the graph is not compiled or has fewer than two inputs.
+    double calculate(double setpoint, double pv);
+
+    std::size_t scheduleSize() const { return _schedule.size(); }
+    std::size_t inputCount() const { return _input_names.size(); }
+    std::size_t outputCount() const { return _outputs.size(); }
+    Signal inputSignal(const std::string &name) const;
+    Signal outputSignal(const std::string &name) const;
+
+private:
+    enum class OpCode : std::uint8_t
+    {
+        Pid,        // law index | integral, pre_error, derivative
+        LowPass,    // alpha | y, primed
+        Derivative, // 1/dt | previous, primed
+        Gain,       // k
+        Sum,        // k
+        Clamp       // lo, hi
+    };
+
+    // Compiled form (POD); operands and result are signal indices
+    struct Op
+    {
+        OpCode code;
+        std::uint32_t a;
+        std::uint32_t b;
+        std::uint32_t out;
+        std::uint32_t data; // Offset of this op's parameters (then state) in _data
+    };
+
+    // Build-time form
+    struct Node
+    {
+        OpCode code;
+        Signal a;
+        Signal b;
+        Signal out;
+        std::array<double, 8> data; // Parameters followed by initial state
+        std::size_t size;
+    };
+
+    Signal newSignal(double initial = 0.0);
+    Signal addNode(OpCode code, Signal a, Signal b, std::initializer_list<double> params, std::size_t state);
+    void checkBuilding(Signal s) const;
+
+    double _dt;
+    bool _compiled;
+
+    std::vector<Node> _nodes;
+    std::vector<std::string> _input_names;
+    std::vector<Signal> _inputs;
+    std::vector<std::string> _output_names;
+    std::vector<Signal> _outputs;
+
+    std::vector<Op> _schedule;
+    std::vector<PIDLaw> _laws;      // PID stages' parameters, indexed from their data
+    std::vector<double> _data;      // Parameters and state, in schedule order
+    std::vector<double> _initial;   // _data as compiled, for reset()
+    std::vector<double> _signals;   // Every signal's current value
+    std::vector<double> _constants; // Initial signal values (constants), for reset()
+};
+
+// Altitude -> velocity -> command cascade for the vehicle plant. Inputs
+// "altitude_sp" and "altitude", output "command". The outer stage's limits
+// bound the climb rate it may ask for, and the inner loop works on the
+// altitude's derivative, low-passed with velocity_filter seconds.
+ControllerGraph makeAltitudeCascade(const PIDStage &altitude, const PIDStage &velocity, double velocity_filter, double dt);
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+// Signed Q-format fixed point: a 32-bit integer holding value * 2^FracBits,
+// e.g. Fixed<16> is Q16.16 (range +/-32768, resolution 1.5e-5). Products are
+// formed in 64 bits and rounded; every result saturates at the range ends
+// instead of wrapping, like the saturating DSP instructions on Cortex-M.
+// Converts explicitly from and to double, so it drops into PIDT<Config, T>
+// and BasicPID<T>.
+template <int FracBits>
+class Fixed
+{
+    static_assert(FracBits > 0 && FracBits < 31, "Fixed needs 1..30 fraction bits");
+
+public:
+    static constexpr int frac_bits = FracBits;
+    static constexpr double scale = static_cast<double>(std::int64_t(1) << FracBits);
+
+    constexpr Fixed() : _raw(0) {}
+    explicit constexpr Fixed(double value) : _raw(saturate(round(value * scale))) {}
+
+    static constexpr Fixed fromRaw(std::int32_t raw)
+    {
+        Fixed f;
+        f._raw = raw;
+        return f;
+    }
+
+    constexpr std::int32_t raw() const { return _raw; }
+    explicit constexpr operator double() const { return _raw / scale; }
+
+    // Largest and smallest representable values
+    static constexpr Fixed max() { return fromRaw(std::numeric_limits<std::int32_t>::max()); }
+    static constexpr Fixed lowest() { return fromRaw(std::numeric_limits<std::int32_t>::min()); }
+
+    constexpr Fixed operator-() const { return fromRaw(saturate(-std::int64_t(_raw))); }
+
+    constexpr Fixed &operator+=(Fixed o)
+    {
+        _raw = saturate(std::int64_t(_raw) + o._raw);
+        return *this;
+    }
+    constexpr Fixed &operator-=(Fixed o)
+    {
+        _raw = saturate(std::int64_t(_raw) - o._raw);
+        return *this;
+    }
+    constexpr Fixed &operator*=(Fixed o)
+    {
+        // Round half up: add half an LSB before the arithmetic shift
+        const std::int64_t product = std::int64_t(_raw) * o._raw;
+        _raw = saturate((product + (std::int64_t(1) << (FracBits - 1))) >> FracBits);
+        return *this;
+    }
+
+    friend constexpr Fixed operator+(Fixed a, Fixed b) { return a += b; }
+    friend constexpr Fixed operator-(Fixed a, Fixed b) { return a -= b; }
+    friend constexpr Fixed operator*(Fixed a, Fixed b) { return a *= b; }
+
+    friend constexpr bool operator==(Fixed a, Fixed b) { return a._raw == b._raw; }
+    friend constexpr bool operator!=(Fixed a, Fixed b) { return a._raw != b._raw; }
+    friend constexpr bool operator<(Fixed a, Fixed b) { return a._raw < b._raw; }
+    friend constexpr bool operator>(Fixed a, Fixed b) { return a._raw > b._raw; }
+    friend constexpr bool operator<=(Fixed a, Fixed b) { return a._raw <= b._raw; }
+    friend constexpr bool operator>=(Fixed a, Fixed b) { return a._raw >= b._raw; }
+
+private:
+    static constexpr std::int64_t round(double x)
+    {
+        // Clamp first: out-of-range double -> integer conversion is undefined
+        if (x != x)
+            return 0; // NaN
+        const double limit = 9.0e18;
+        x = (x > limit) ? limit : (x < -limit) ? -limit : x;
+        return static_cast<std::int64_t>((x >= 0.0) ? x + 0.5 : x - 0.5);
+    }
+
+    static constexpr std::int32_t saturate(std::int64_t x)
+    {
+        return (x > std::numeric_limits<std::int32_t>::max()) ? std::numeric_limits<std::int32_t>::max()
+               : (x < std::numeric_limits<std::int32_t>::min()) ? std::numeric_limits<std::int32_t>::min()
+                                                                : static_cast<std::int32_t>(x);
+    }
+
+    std::int32_t _raw;
+};
+
+using Q16_16 = Fixed<16>; // +/-32768, 1.5e-5 resolution
+using Q12_20 = Fixed<20>; // +/-2048, 9.5e-7 resolution
@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+#include <limits>
 
 // Abstract Base Class
 class ISensor {
@@ -8,4 +10,19 @@ public:
     // Pure virtual function: any sensor MUST implement this
     virtual void init() = 0;
     virtual double readValue() = 0;
-};
\ No newline at end of file
+
+    // Burst read (e.g. a DMA transfer): writes up to count samples to values and,
+    // if timestamps is not null, their sample times in seconds. Returns how many
+    // samples were delivered. The default falls back to readValue() per sample
+    // and reports NaN timestamps, for sensors without a sample clock.
+    virtual std::size_t readBatch(double *values, double *timestamps, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            values[i] = readValue();
+            if (timestamps)
+                timestamps[i] = std::numeric_limits<double>::quiet_NaN();
+        }
+        return count;
+    }
+};
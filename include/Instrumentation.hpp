@@ -0,0 +1,90 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include "LatencyHistogram.hpp"
+
+#if defined(AEROSTREAM_INSTRUMENT_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+// Low-overhead loop stage timing.
+//
+// AEROSTREAM_SCOPED_TIMER(histogram) times the rest of the enclosing scope
+// into a LatencyHistogram. Unless the build defines
+// AEROSTREAM_ENABLE_INSTRUMENTATION (CMake option of the same name) the macro
+// expands to nothing, and its argument is not even evaluated.
+// With AEROSTREAM_INSTRUMENT_RDTSC on x86, timestamps come from the TSC
+// (calibrated once against steady_clock) instead of steady_clock.
+
+namespace instrumentation
+{
+#if defined(AEROSTREAM_INSTRUMENT_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+    // Nanoseconds per TSC tick, measured on first use
+    double tscNanosPerTick();
+
+    inline std::uint64_t ticks() { return __rdtsc(); }
+    inline std::uint64_t ticksToNanos(std::uint64_t t) { return static_cast<std::uint64_t>(t * tscNanosPerTick()); }
+    inline const char *clockName() { return "rdtsc"; }
+    inline void calibrate() { tscNanosPerTick(); }
+#else
+    inline std::uint64_t ticks()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    inline std::uint64_t ticksToNanos(std::uint64_t t) { return t; }
+    inline const char *clockName() { return "steady_clock"; }
+    inline void calibrate() {}
+#endif
+}
+
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(LatencyHistogram &histogram) : _histogram(histogram), _start(instrumentation::ticks()) {}
+    ~ScopedTimer() { _histogram.record(instrumentation::ticksToNanos(instrumentation::ticks() - _start)); }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+private:
+    LatencyHistogram &_histogram;
+    std::uint64_t _start;
+};
+
+#define AEROSTREAM_CONCAT_INNER(a, b) a##b
+#define AEROSTREAM_CONCAT(a, b) AEROSTREAM_CONCAT_INNER(a, b)
+
+#ifdef AEROSTREAM_ENABLE_INSTRUMENTATION
+#define AEROSTREAM_SCOPED_TIMER(histogram) ScopedTimer AEROSTREAM_CONCAT(aerostream_timer_, __LINE__)(histogram)
+#else
+#define AEROSTREAM_SCOPED_TIMER(histogram) ((void)0)
+#endif
+
+// The stages of one control tick in main.cpp
+enum class LoopStage
+{
+    SensorRead,
+    Controller,
+    Physics,
+    Telemetry,
+    Tick, // Whole iteration
+    Count
+};
+
+// One histogram per loop stage, dumped as JSON at exit
+class LoopProfiler
+{
+public:
+    // Calibrates the clock up front so the first timed tick does not pay for it
+    LoopProfiler() { instrumentation::calibrate(); }
+
+    LatencyHistogram &stage(LoopStage s) { return _stages[static_cast<int>(s)]; }
+    const LatencyHistogram &stage(LoopStage s) const { return _stages[static_cast<int>(s)]; }
+
+    // {"build": {...}, "stages": {"sensor_read": {"count", "mean_ns", "p50_ns", "p99_ns", "p999_ns", "max_ns"}, ...}}
+    void writeJson(std::ostream &out) const;
+
+private:
+    LatencyHistogram _stages[static_cast<int>(LoopStage::Count)];
+};
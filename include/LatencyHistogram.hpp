@@ -0,0 +1,46 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <ostream>
+
+// Log-linear latency histogram in nanoseconds (HDR-style): each power of two
+// is split into 32 sub-buckets, so any recorded value is kept to within ~3%
+// from 1 ns up to ~18 minutes, in a fixed 9 KiB table. record() is O(1) and
+// never allocates, so it is safe inside the control loop.
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    void record(std::uint64_t ns);
+    void merge(const LatencyHistogram &other);
+    void reset();
+
+    std::uint64_t count() const { return _count; }
+    std::uint64_t min() const { return _count ? _min : 0; }
+    std::uint64_t max() const { return _max; }
+    double mean() const { return _count ? static_cast<double>(_sum) / _count : 0.0; }
+
+    // Value at quantile q in [0, 1] (e.g. 0.999 for p99.9), reported as the
+    // upper edge of its bucket and capped at the recorded maximum
+    std::uint64_t percentile(double q) const;
+
+    // "LowerNs,UpperNs,Count" rows for the non-empty buckets
+    void writeCsv(std::ostream &out) const;
+
+private:
+    static const int kSubBucketBits = 5;
+    static const int kSubBuckets = 1 << kSubBucketBits;
+    static const int kMagnitudes = 40 - kSubBucketBits + 1; // Values up to 2^40 ns
+    static const int kBuckets = kMagnitudes * kSubBuckets;
+
+    static int bucketOf(std::uint64_t ns);
+    static std::uint64_t lowerEdge(int bucket);
+    static std::uint64_t upperEdge(int bucket);
+
+    std::array<std::uint64_t, kBuckets> _buckets;
+    std::uint64_t _count;
+    std::uint64_t _sum;
+    std::uint64_t _min;
+    std::uint64_t _max;
+};
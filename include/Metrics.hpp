@@ -0,0 +1,59 @@
+#pragma once
+#include <ostream>
+#include "Mission.hpp"
+
+// Result of a run, as shown on the GCS dashboard
+struct MetricsSummary
+{
+    double rmse;
+    double overshoot_percent;
+    double settling_time; // Seconds after segment start, infinity if never settled
+    int samples;          // Number of samples inside the evaluated segment
+};
+
+// Streaming replacement for calculate_metrics() in app.py.
+// Every update is O(1), so it can run inside the control loop.
+class Metrics
+{
+public:
+    // segment_start: first step that counts (the setpoint switch for step responses)
+    // target: final setpoint the response is judged against
+    // start_value: where the response starts from (decides the overshoot direction)
+    Metrics(int segment_start, double target, double start_value, double dt, double tolerance = 0.02);
+
+    // Same segment/target rules the dashboard uses for a given mission
+    explicit Metrics(const MissionProfile &mission, double tolerance = 0.02);
+
+    // Feed one telemetry sample
+    void update(int step, double target, double actual);
+
+    MetricsSummary summary() const;
+
+    // Smallest RMSE the run can still finish with: the error so far spread
+    // over every sample of the segment (mission constructor only; otherwise
+    // over the samples seen). Lets a caller abandon a run that can no longer win.
+    double rmseLowerBound() const;
+
+    // Clears the accumulated state so the object can be reused for another run
+    void reset();
+
+private:
+    int _segment_start;
+    double _target;
+    double _start_value;
+    double _dt;
+    double _upper_bound; // Settling band
+    double _lower_bound;
+
+    int _expected_samples; // Segment length, 0 if unknown
+
+    double _sum_sq_error;
+    double _max_actual;
+    double _min_actual;
+    int _samples;
+    int _last_step;
+    int _last_out_of_band; // Last step that was outside the band, -1 if none
+};
+
+// Writes the summary as a two-line CSV record (header + values), e.g. for metrics.csv
+void writeSummaryCsv(std::ostream &out, const MetricsSummary &summary);
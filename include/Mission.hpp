@@ -0,0 +1,31 @@
+#pragma once
+#include "Noise.hpp"
+#include "PID.hpp"
+#include "Plant.hpp"
+
+// Controller gains for one candidate (what the tuner searches over)
+struct PIDGains
+{
+    double kp;
+    double ki;
+    double kd;
+};
+
+// Everything that describes a mission except the controller gains
+struct MissionProfile
+{
+    int steps = 1000;
+    double target1 = 50.0;  // Setpoint before the switch
+    double target2 = 100.0; // Setpoint from switch_step onwards
+    int switch_step = 500;
+    double dt = 0.1;
+    double max_output = 500.0; // Motor limits
+    double min_output = -500.0;
+    double initial_altitude = 0.0;
+    SensorNoise noise; // Altimeter noise model and seed
+    PlantConfig plant; // What the motor command drives (default: the original integrator)
+    PIDOptions pid;    // Derivative filter / anti-windup (default: plain PID)
+
+    // Setpoint for a given step of the mission
+    double targetAt(int step) const { return (step < switch_step) ? target1 : target2; }
+};
@@ -1,16 +1,59 @@
 #pragma once
+#include <array>
+#include <cstddef>
 #include "ISensor.hpp"
+#include "SensorBase.hpp"
+#include "Noise.hpp"
 
-class MockSensor : public ISensor
+// Usable through ISensor (virtual) or SensorBase (static, inlined). Marked
+// final so calls through a MockSensor& are devirtualized as well.
+class MockSensor final : public ISensor, public SensorBase<MockSensor>
 {
 public:
     MockSensor(double initial_value);
+    MockSensor(double initial_value, const SensorNoise &noise);
     void init() override;
-    double readValue() override;
+    double readValue() override { return sample(); }
+
+    // Serves count samples at once from block-generated noise. The values are
+    // identical to count readValue() calls; timestamp = sample index * period.
+    std::size_t readBatch(double *values, double *timestamps, std::size_t count) override;
+
+    // Static-dispatch reading used by SensorBase::read()
+    double sample()
+    {
+        // Simulate sensor noise, drawn in blocks from this sensor's own RNG stream
+        if (_noise_pos == kNoiseBlock)
+            refillNoise();
+        _samples++;
+        return _value + _noise_block[_noise_pos++];
+    }
 
     // Helper to update the internal state (simulating physics)
     void update(double step_value);
 
+    // Sets the true value directly, when a Plant owns the physics
+    void setValue(double value) { _value = value; }
+
+    // Pre-generates count noise samples from this sensor's stream
+    void fillNoise(double *out, std::size_t count);
+
+    // Restarts the noise stream, e.g. before re-running the same mission
+    void reseed(std::uint64_t seed);
+
+    // Time between samples, used for readBatch() timestamps (default 0.1 s)
+    void setSamplePeriod(double period) { _sample_period = period; }
+
 private:
+    static const std::size_t kNoiseBlock = 64;
+
+    void refillNoise();
+
     double _value;
-};
\ No newline at end of file
+    NoiseGenerator _noise;
+    std::array<double, kNoiseBlock> _noise_block; // Noise for the next readValue() calls
+    std::size_t _noise_pos;
+
+    std::size_t _samples; // Samples delivered so far (sample clock)
+    double _sample_period;
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Metrics.hpp"
+#include "Mission.hpp"
+
+// Half-widths of the uniform spread applied to each Monte Carlo sample, as a
+// fraction of the mission's nominal value (0.1 = +/- 10 %). The vehicle terms
+// only matter with PlantType::Vehicle. Each must lie in [0, 1), so a drawn
+// value keeps the nominal's sign (a zero or negative mass cannot fly).
+struct PlantPerturbation
+{
+    double mass = 0.0;
+    double thrust_gain = 0.0;
+    double drag = 0.0;
+    double motor_tau = 0.0;
+    double noise = 0.0; // Sensor noise amplitude
+};
+
+struct MonteCarloConfig
+{
+    int samples = 32;       // K noise seeds / plant draws per candidate
+    std::uint64_t seed = 1; // Base of every sample's random stream
+    // Common random numbers: sample k is the same noise stream and plant for
+    // every candidate, so differences between candidates are not swamped by
+    // sample-to-sample scatter. Off = every candidate gets its own draws.
+    bool common_random_numbers = true;
+    PlantPerturbation perturbation;
+    std::size_t threads = 0; // 0 = all hardware threads
+};
+
+// Mean, (unbiased) variance and worst (largest) value over the samples
+struct SampleStats
+{
+    double mean;
+    double variance;
+    double worst;
+};
+
+struct MonteCarloResult
+{
+    PIDGains gains;
+    SampleStats rmse;
+    SampleStats overshoot_percent;
+    SampleStats settling_time; // Over the samples that settled; worst is infinity if any did not
+    int unsettled;             // Samples that never settled
+    SampleStats rmse_delta;    // RMSE minus candidate 0's RMSE on the same sample index
+};
+
+// The mission flown as sample `sample` of candidate `candidate`: its own noise
+// seed and perturbed plant. With common random numbers the candidate is ignored.
+MissionProfile monteCarloSample(const MissionProfile &mission, const MonteCarloConfig &config, int sample,
+                                std::size_t candidate);
+
+// Flies every candidate over config.samples perturbed missions on a thread pool
+// and returns one result per candidate, in input order. With common random
+// numbers each sample is one PIDBatch pass over all candidates. With no
+// samples the results carry only the gains (every statistic zero).
+// Throws std::invalid_argument if a perturbation spread is outside [0, 1).
+std::vector<MonteCarloResult> runMonteCarlo(const std::vector<PIDGains> &candidates, const MissionProfile &mission,
+                                            const MonteCarloConfig &config);
+
+// Statistics of values (count >= 1; variance 0 for a single value)
+SampleStats sampleStats(const std::vector<double> &values);
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// xoshiro256** (Blackman & Vigna): small, fast and statistically solid.
+// Each instance owns its state, so simulations on different threads never share a stream.
+class Xoshiro256
+{
+public:
+    explicit Xoshiro256(std::uint64_t seed = 1) { reseed(seed); }
+
+    // Expands the seed with splitmix64 so that nearby seeds give unrelated streams
+    void reseed(std::uint64_t seed)
+    {
+        for (std::uint64_t &word : _s)
+        {
+            seed += 0x9e3779b97f4a7c15ULL;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    std::uint64_t next()
+    {
+        const std::uint64_t result = rotl(_s[1] * 5, 7) * 9;
+        const std::uint64_t t = _s[1] << 17;
+        _s[2] ^= _s[0];
+        _s[3] ^= _s[1];
+        _s[1] ^= _s[2];
+        _s[0] ^= _s[3];
+        _s[2] ^= t;
+        _s[3] = rotl(_s[3], 45);
+        return result;
+    }
+
+    // Uniform double in [0, 1) with 53 bits of resolution
+    double nextDouble() { return (next() >> 11) * 0x1.0p-53; }
+
+private:
+    static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    std::uint64_t _s[4];
+};
+
+enum class NoiseDistribution
+{
+    Uniform, // Uniform in [-amplitude, +amplitude)
+    Gaussian // Zero mean, standard deviation = amplitude
+};
+
+struct SensorNoise
+{
+    NoiseDistribution distribution = NoiseDistribution::Uniform;
+    double amplitude = 0.5; // +/- 0.5 meters, like the original rand() noise
+    std::uint64_t seed = 1;
+};
+
+// Generates sensor noise in blocks from a private RNG stream
+class NoiseGenerator
+{
+public:
+    explicit NoiseGenerator(const SensorNoise &config = SensorNoise());
+
+    // Writes count noise samples to out
+    void fill(double *out, std::size_t count);
+
+    // Restarts the stream (same seed = same samples)
+    void reseed(std::uint64_t seed) { _rng.reseed(seed); }
+
+    const SensorNoise &config() const { return _config; }
+
+private:
+    SensorNoise _config;
+    Xoshiro256 _rng;
+};
@@ -0,0 +1,74 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "RunLimits.hpp"
+#include "Simulation.hpp"
+#include "ThreadPool.hpp"
+#include "Tuner.hpp"
+
+// Gradient-free tuners. The population methods evaluate a whole generation
+// per simulateBatchBounded() pass (one PIDBatch, optionally split across a
+// ThreadPool). Nelder-Mead and DE give every candidate the cost it has to
+// beat so hopeless runs stop early; CMA-ES ranks whole generations, so its
+// candidates only stop when they diverge.
+enum class OptimizerMethod
+{
+    Twiddle,               // The sequential Tuner
+    NelderMead,            // Simplex; reflection, expansion and both contractions are evaluated as one batch
+    DifferentialEvolution, // DE/rand/1/bin
+    CmaEs                  // (mu/mu_w, lambda) CMA-ES
+};
+
+// Accepts "twiddle", "nelder-mead", "de" and "cmaes". Returns false for anything else.
+bool parseOptimizerMethod(const std::string &name, OptimizerMethod &method);
+
+struct OptimizerConfig
+{
+    OptimizerMethod method = OptimizerMethod::NelderMead;
+    TuningStrategy strategy = TuningStrategy::Accuracy;
+    std::array<double, 3> initial = {0.5, 0.0, 0.0}; // Starting Kp, Ki, Kd
+    std::array<double, 3> scale = {0.5, 0.05, 0.1};  // Initial spread per gain
+    int max_evaluations = 600;                       // Simulation budget (a generation may finish past it)
+    int population = 0;                              // DE / CMA-ES size, 0 = method default (16 / 8)
+    std::uint64_t seed = 1;                          // Random stream of DE and CMA-ES
+    unsigned threads = 1;                            // Worker threads per generation
+    RunLimits limits = divergenceLimits();           // Divergence criteria (rmse_bound is set per candidate)
+    ResultCache *cache = nullptr;                    // Shared result cache for Twiddle (see TunerConfig)
+};
+
+// Runs the configured method. Gains are kept non-negative.
+TuningResult optimizeGains(const MissionProfile &mission, const OptimizerConfig &config);
+
+// Costs a batch of candidates for the optimizers and keeps the running best
+class PopulationEvaluator
+{
+public:
+    PopulationEvaluator(const MissionProfile &mission, TuningStrategy strategy, unsigned threads = 1,
+                        const RunLimits &limits = divergenceLimits());
+
+    // One cost per candidate; candidates whose cost provably exceeds
+    // bounds[c], or that diverge, are stopped early and cost infinity
+    std::vector<double> evaluate(const std::vector<PIDGains> &candidates, const std::vector<double> &bounds);
+
+    const PIDGains &best() const { return _best; }
+    double bestCost() const { return _best_cost; }
+    int evaluations() const { return _evaluations; }
+    int aborted() const { return _aborted; }
+
+private:
+    MissionProfile _mission;
+    TuningStrategy _strategy;
+    RunLimits _limits;
+    std::unique_ptr<ThreadPool> _pool;
+    PIDGains _best;
+    double _best_cost;
+    int _evaluations;
+    int _aborted;
+};
+
+// Eigen-decomposition of a symmetric 3x3 matrix by cyclic Jacobi rotations:
+// a = V diag(values) V^T, eigenvectors in the columns of vectors
+void jacobiEigen3(const double a[3][3], double values[3], double vectors[3][3]);
@@ -1,9 +1,92 @@
 #pragma once
+#include <algorithm> // for std::clamp (C++17)
+
+// How the integrator behaves while the output is clamped
+enum class AntiWindup
+{
+    None,           // Integrates unconditionally (the original behaviour)
+    Conditional,    // Holds the integral while clamped and the error pushes further into the limit
+    BackCalculation // Bleeds the integral by back_calculation_gain * (clamped - unclamped output)
+};
+
+// Optional refinements of the plain PID. The defaults leave every one off,
+// and then calculate() is bit-identical to the original controller.
+struct PIDOptions
+{
+    double derivative_filter = 0.0;         // Low-pass time constant on the D term (s), 0 = off
+    bool derivative_on_measurement = false; // Differentiate -pv instead of the error (no setpoint kick)
+    AntiWindup anti_windup = AntiWindup::None;
+    double back_calculation_gain = 0.0;     // Tracking gain 1/Tt (1/s); 0 = ki / kp (Tt = integral time)
+};
+
+// Tracking gain over ki, i.e. the back-calculation gain applied to the stored error integral
+double backCalculationGain(double kp, double ki, const PIDOptions &options);
+
+// The PID arithmetic with the options folded in. PID and the PID stages of
+// ControllerGraph both run calculate(), so they cannot drift apart; the caller
+// owns the state (integral, previous error or -pv, filtered derivative).
+struct PIDLaw
+{
+    PIDLaw(double kp, double ki, double kd, double dt, double max_output, double min_output, const PIDOptions &options);
+
+    // Selects between results instead of branching on the options
+    double calculate(double setpoint, double pv, double &integral, double &pre_error, double &derivative) const
+    {
+        // 1. Calculate Error
+        double error = setpoint - pv;
+
+        // 2. Proportional Term
+        double P = kp * error;
+
+        // 3. Integral Term (Accumulate error over time)
+        double next_integral = integral + error * dt;
+        double I = ki * next_integral;
+
+        // 4. Derivative Term (Rate of change of error, or of -pv), optionally low-passed
+        double d_input = on_measurement ? -pv : error;
+        double raw_derivative = (d_input - pre_error) / dt;
+        double filtered = derivative + alpha * (raw_derivative - derivative);
+        raw_derivative = filter ? filtered : raw_derivative;
+        double D = kd * raw_derivative;
+
+        // 5. Calculate Total Output
+        double unclamped = P + I + D;
+
+        // 6. Clamp output to hardware limits (Safety!)
+        double output = std::clamp(unclamped, min_output, max_output);
+
+        // 7. Anti-windup: both variants are computed, the options select (no branches)
+        bool hold = conditional & (unclamped != output) & (error * unclamped > 0.0);
+        double back = next_integral + back_gain * (output - unclamped) * dt;
+        next_integral = hold ? integral : next_integral;
+        integral = back_calculation ? back : next_integral;
+
+        // 8. Save state for next loop
+        pre_error = d_input;
+        derivative = raw_derivative;
+
+        return output;
+    }
+
+    double kp;
+    double ki;
+    double kd;
+    double dt;          // Time step (loop interval)
+    double max_output;  // Saturation limits (Motor limits)
+    double min_output;
+    bool filter;        // Derivative low-pass on
+    double alpha;       // dt / (tau + dt)
+    bool on_measurement;
+    bool conditional;
+    bool back_calculation;
+    double back_gain;   // Tracking gain / ki, in units of the stored integral
+};
 
 class PID {
 public:
     // Constructor: Takes the 3 controller gains and a limit for the output
     PID(double kp, double ki, double kd, double dt, double max_output, double min_output);
+    PID(double kp, double ki, double kd, double dt, double max_output, double min_output, const PIDOptions &options);
 
     // The main function that computes the control signal
     double calculate(double setpoint, double pv);
@@ -15,13 +98,9 @@ public:
     ~PID();
 
 private:
-    double _kp;
-    double _ki;
-    double _kd;
-    double _dt;          // Time step (loop interval)
-    double _max_output;  // Saturation limits (Motor limits)
-    double _min_output;
-
-    double _pre_error;   // Previous error for Derivative term
+    PIDLaw _law;         // Gains, limits and folded options
+
+    double _pre_error;   // Previous error (or -pv) for Derivative term
     double _integral;    // Accumulated error for Integral term
+    double _derivative;  // Filtered derivative
 };
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "PID.hpp"
+
+// N independent PID controllers stepped together (structure-of-arrays).
+// Each lane follows exactly the same arithmetic as PID::calculate, so lane i
+// produces bit-identical outputs to a PID built with the same gains.
+// Uses AVX or NEON when the compiler targets them, scalar code otherwise.
+// PIDOptions apply to every lane; they are blended in with masks, so the
+// vector kernels stay branch-free.
+class PIDBatch
+{
+public:
+    // All lanes share the loop interval and motor limits; gains start at zero
+    PIDBatch(std::size_t lanes, double dt, double max_output, double min_output);
+    PIDBatch(std::size_t lanes, double dt, double max_output, double min_output, const PIDOptions &options);
+
+    void setGains(std::size_t lane, double kp, double ki, double kd);
+
+    // Steps every lane once. All arrays hold size() elements.
+    void calculate(const double *setpoint, const double *pv, double *output);
+
+    // Resets integral, previous error and filtered derivative of every lane
+    void reset();
+
+    std::size_t size() const { return _kp.size(); }
+
+private:
+    std::vector<double> _kp;
+    std::vector<double> _ki;
+    std::vector<double> _kd;
+    std::vector<double> _integral;
+    std::vector<double> _pre_error;
+    std::vector<double> _derivative; // Filtered derivative
+    std::vector<double> _back_gain;  // backCalculationGain() per lane
+
+    double _dt;
+    double _max_output;
+    double _min_output;
+    PIDOptions _options;
+    double _alpha; // Derivative filter coefficient, dt / (tau + dt)
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <algorithm> // for std::clamp (C++17)
+
+// Compile-time configured PID for fixed flight builds.
+//
+// Config provides the gains and limits as static constexpr doubles:
+//
+//   struct AltitudeHold
+//   {
+//       static constexpr double kp = 0.6, ki = 0.01, kd = 0.05;
+//       static constexpr double dt = 0.1, max_output = 500.0, min_output = -500.0;
+//   };
+//   PIDT<AltitudeHold, float> pid;
+//
+// Terms whose gain is zero are removed at compile time, and ki*dt and kd/dt
+// are folded into constants, so calculate() needs no division and inlines
+// fully into the loop. T selects the arithmetic type (double, float, ...).
+// Same calculate()/reset() interface as PID (see Controller.hpp).
+template <typename Config, typename T = double>
+class PIDT
+{
+public:
+    using value_type = T;
+
+    T calculate(T setpoint, T pv)
+    {
+        // 1. Calculate Error
+        T error = setpoint - pv;
+        T output = T(0);
+
+        // 2. Proportional Term
+        if constexpr (Config::kp != 0.0)
+            output += kP * error;
+
+        // 3. Integral Term (ki * dt folded into the accumulator)
+        if constexpr (Config::ki != 0.0)
+        {
+            _i_term += kIdt * error;
+            output += _i_term;
+        }
+
+        // 4. Derivative Term (kd / dt precomputed)
+        if constexpr (Config::kd != 0.0)
+        {
+            output += kDinvDt * (error - _pre_error);
+            _pre_error = error;
+        }
+
+        // 5. Clamp output to hardware limits (Safety!)
+        return std::clamp(output, kMin, kMax);
+    }
+
+    void reset()
+    {
+        _i_term = T(0);
+        _pre_error = T(0);
+    }
+
+private:
+    static constexpr T kP = T(Config::kp);
+    static constexpr T kIdt = T(Config::ki * Config::dt);
+    static constexpr T kDinvDt = T(Config::kd / Config::dt);
+    static constexpr T kMax = T(Config::max_output);
+    static constexpr T kMin = T(Config::min_output);
+
+    T _i_term = T(0);    // ki * accumulated (error * dt)
+    T _pre_error = T(0); // Previous error for Derivative term
+};
@@ -0,0 +1,253 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// What the controller output drives
+enum class PlantType
+{
+    Integrator, // altitude += command * dt (the original MockSensor physics)
+    Vehicle     // Point mass with thrust, gravity, drag and motor lag
+};
+
+// Fixed-step integrator for the vehicle's altitude/velocity state
+enum class IntegratorMethod
+{
+    SemiImplicitEuler, // v += a(v) dt, then z += v dt
+    RK4                // Classic 4th-order Runge-Kutta over (z, v)
+};
+
+// Vertical dynamics of one vehicle. The command is a thrust increment around
+// hover (a linearized thrust curve), so a zero command holds altitude:
+//   thrust_cmd = clamp(mass * gravity + thrust_gain * command, 0, max_thrust)
+//   thrust'    = (thrust_cmd - thrust) / motor_tau
+//   v'         = (thrust - mass * gravity - drag * v|v|) / mass
+//   z'         = v,  with the ground at z = 0
+struct VehicleParams
+{
+    double mass = 1.5;         // kg
+    double gravity = 9.81;     // m/s^2
+    double thrust_gain = 0.05; // N per command unit
+    double max_thrust = 40.0;  // N, total motor limit
+    double drag = 0.05;        // N / (m/s)^2, quadratic
+    double motor_tau = 0.05;   // s, first-order motor lag (0 = instant)
+};
+
+struct PlantConfig
+{
+    PlantType type = PlantType::Integrator;
+    IntegratorMethod integrator = IntegratorMethod::RK4;
+    VehicleParams vehicle;
+
+    // Vehicle steps per control step, each dt / substeps long, with the command
+    // held: the physics runs at substeps / dt Hz while the controller and
+    // telemetry stay at 1 / dt. The integrator plant is exact for a held
+    // command, so it ignores this.
+    int substeps = 1;
+};
+
+// Parse "integrator"/"vehicle" and "euler"/"rk4". Return false (value untouched) if unknown.
+bool parsePlantType(const std::string &name, PlantType &type);
+bool parseIntegratorMethod(const std::string &name, IntegratorMethod &method);
+
+// Runtime-pluggable plant, for loops configured at run time. Hot loops use the
+// final classes directly (see withPlant) or PlantBatch, so nothing is virtual there.
+class Plant
+{
+public:
+    virtual ~Plant() = default;
+    virtual void reset(double altitude) = 0;
+    virtual void step(double command, double dt) = 0;
+    virtual double altitude() const = 0;
+    virtual double velocity() const = 0;
+};
+
+// The original physics: the command is a climb rate. Bit-identical to MockSensor::update(command * dt).
+class IntegratorPlant final : public Plant
+{
+public:
+    explicit IntegratorPlant(double altitude = 0.0) : _altitude(altitude), _velocity(0.0) {}
+
+    void reset(double altitude) override
+    {
+        _altitude = altitude;
+        _velocity = 0.0;
+    }
+    void step(double command, double dt) override
+    {
+        _velocity = command;
+        _altitude += command * dt;
+    }
+    double altitude() const override { return _altitude; }
+    double velocity() const override { return _velocity; }
+
+private:
+    double _altitude;
+    double _velocity;
+};
+
+namespace plant_detail
+{
+    // VehicleParams folded for one dt, so a step needs no divisions or exp()
+    struct VehicleStep
+    {
+        double weight;      // mass * gravity, also the hover thrust trim
+        double inv_mass;
+        double drag;
+        double thrust_gain;
+        double max_thrust;
+        double lag;         // 1 - exp(-dt / motor_tau)
+        double dt;          // Substep length
+        double dt_6;        // dt / 6 for RK4
+    };
+
+    inline VehicleStep vehicleStep(const VehicleParams &p, double dt)
+    {
+        const double lag = (p.motor_tau > 0.0) ? 1.0 - std::exp(-dt / p.motor_tau) : 1.0;
+        return {p.mass * p.gravity, 1.0 / p.mass, p.drag, p.thrust_gain, p.max_thrust, lag, dt, dt / 6.0};
+    }
+
+    inline double acceleration(const VehicleStep &k, double thrust, double v)
+    {
+        return (thrust - k.weight - k.drag * v * std::abs(v)) * k.inv_mass;
+    }
+
+    // One vehicle step. Straight-line code (min/max/selects only), so the
+    // PlantBatch lane loop vectorizes.
+    template <IntegratorMethod Method>
+    inline void stepVehicle(const VehicleStep &k, double command, double &z, double &v, double &thrust)
+    {
+        // 1. Motor lag, solved exactly for a command held over the step
+        const double thrust_cmd = std::min(std::max(k.weight + k.thrust_gain * command, 0.0), k.max_thrust);
+        thrust += (thrust_cmd - thrust) * k.lag;
+
+        // 2. Rigid body, with thrust held over the step
+        if (Method == IntegratorMethod::RK4)
+        {
+            const double h = 0.5 * k.dt;
+            const double a1 = acceleration(k, thrust, v);
+            const double v2 = v + h * a1;
+            const double a2 = acceleration(k, thrust, v2);
+            const double v3 = v + h * a2;
+            const double a3 = acceleration(k, thrust, v3);
+            const double v4 = v + k.dt * a3;
+            const double a4 = acceleration(k, thrust, v4);
+            z += k.dt_6 * (v + 2.0 * v2 + 2.0 * v3 + v4);
+            v += k.dt_6 * (a1 + 2.0 * a2 + 2.0 * a3 + a4);
+        }
+        else
+        {
+            v += acceleration(k, thrust, v) * k.dt;
+            z += v * k.dt;
+        }
+
+        // 3. Ground contact: cannot sink below 0 or keep falling into it
+        const bool grounded = z < 0.0;
+        z = grounded ? 0.0 : z;
+        v = grounded ? std::max(v, 0.0) : v;
+    }
+
+    // substeps vehicle steps under one held command; the loop body has no branches
+    template <IntegratorMethod Method>
+    inline void substepVehicle(const VehicleStep &k, int substeps, double command, double &z, double &v, double &thrust)
+    {
+        for (int s = 0; s < substeps; s++)
+            stepVehicle<Method>(k, command, z, v, thrust);
+    }
+
+    // Thrust that holds a vehicle still (also the state it starts in)
+    inline double hoverThrust(const VehicleParams &p) { return std::min(p.mass * p.gravity, p.max_thrust); }
+}
+
+class VehiclePlant final : public Plant
+{
+public:
+    explicit VehiclePlant(const PlantConfig &config, double altitude = 0.0)
+        : _params(config.vehicle), _method(config.integrator), _substeps(std::max(config.substeps, 1)), _dt(0.0),
+          _step(plant_detail::vehicleStep(_params, 0.1))
+    {
+        reset(altitude);
+    }
+
+    // Starts at rest, motors at hover thrust
+    void reset(double altitude) override
+    {
+        _altitude = altitude;
+        _velocity = 0.0;
+        _thrust = plant_detail::hoverThrust(_params);
+    }
+    void step(double command, double dt) override
+    {
+        if (dt != _dt)
+        {
+            _step = plant_detail::vehicleStep(_params, dt / _substeps);
+            _dt = dt;
+        }
+        if (_method == IntegratorMethod::RK4)
+            plant_detail::substepVehicle<IntegratorMethod::RK4>(_step, _substeps, command, _altitude, _velocity, _thrust);
+        else
+            plant_detail::substepVehicle<IntegratorMethod::SemiImplicitEuler>(_step, _substeps, command, _altitude,
+                                                                              _velocity, _thrust);
+    }
+    double altitude() const override { return _altitude; }
+    double velocity() const override { return _velocity; }
+    double thrust() const { return _thrust; }
+
+private:
+    VehicleParams _params;
+    IntegratorMethod _method;
+    int _substeps;
+    double _dt;                      // Control step that _step was folded for
+    plant_detail::VehicleStep _step; // One substep of _dt
+
+    double _altitude;
+    double _velocity;
+    double _thrust;
+};
+
+std::unique_ptr<Plant> makePlant(const PlantConfig &config, double altitude);
+
+// Runs body(plant) with the concrete plant for config, so the loop in body is
+// compiled once per plant type and every step() call inlines.
+template <typename Body>
+auto withPlant(const PlantConfig &config, double altitude, Body &&body)
+{
+    if (config.type == PlantType::Vehicle)
+    {
+        VehiclePlant plant(config, altitude);
+        return body(plant);
+    }
+    IntegratorPlant plant(altitude);
+    return body(plant);
+}
+
+// Structure-of-arrays plant for n lanes with the same config, stepped
+// together like PIDBatch. The plant type and integrator are resolved once per
+// step(), so each lane loop is branch-free and vectorizable.
+class PlantBatch
+{
+public:
+    PlantBatch(std::size_t lanes, const PlantConfig &config, double altitude);
+
+    std::size_t size() const { return _altitude.size(); }
+
+    // Advances every lane by dt under command[lane] (in config.substeps substeps)
+    void step(const double *command, double dt);
+
+    const double *altitude() const { return _altitude.data(); }
+    double altitude(std::size_t lane) const { return _altitude[lane]; }
+    double velocity(std::size_t lane) const { return _velocity[lane]; }
+
+private:
+    PlantConfig _config;
+    int _substeps;
+    double _dt;                      // Control step that _step was folded for
+    plant_detail::VehicleStep _step; // One substep of _dt
+
+    std::vector<double> _altitude;
+    std::vector<double> _velocity;
+    std::vector<double> _thrust;
+};
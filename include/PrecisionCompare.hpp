@@ -0,0 +1,33 @@
+#pragma once
+#include <vector>
+#include "Metrics.hpp"
+#include "Mission.hpp"
+
+// Arithmetic representations the precision harness can fly
+enum class NumericType
+{
+    Reference, // PID (double), what the others are compared against
+    Double,    // BasicPID<double>
+    Float,     // BasicPID<float>
+    Q16_16,    // BasicPID<Fixed<16>>
+    Q12_20     // BasicPID<Fixed<20>>
+};
+
+// "pid", "double", "float", "q16.16", "q12.20"
+const char *numericTypeName(NumericType type);
+
+struct PrecisionReport
+{
+    NumericType type;
+    MetricsSummary metrics;    // The mission flown closed loop with this controller
+    double max_altitude_error; // Largest |altitude - reference altitude| over that flight (m)
+    double max_output_error;   // Largest |command - reference command| fed the reference's readings (open loop)
+    double ns_per_step;        // step() alone in the native type, best of the repeats
+};
+
+// Flies the mission with every NumericType and compares each against the
+// reference PID. The plant, noise and metrics stay in double (they model the
+// world, not the flight computer); only the controller changes representation.
+// mission.pid is ignored: the comparison is of the plain PID arithmetic.
+// A negative mission.steps is treated as 0.
+std::vector<PrecisionReport> comparePrecision(const PIDGains &gains, const MissionProfile &mission, int repeats = 20);
@@ -0,0 +1,61 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include "LatencyHistogram.hpp"
+
+struct RealTimeConfig
+{
+    double rate_hz = 1000.0;             // Control loop rate
+    int cpu = -1;                        // Pin the loop thread to this CPU (-1 = no pinning)
+    bool fifo = false;                   // Request SCHED_FIFO (needs CAP_SYS_NICE or root)
+    int fifo_priority = 80;
+    std::int64_t spin_ns = 50000;        // Busy-wait this long before each deadline
+};
+
+struct RealTimeStats
+{
+    std::uint64_t ticks = 0;
+    std::uint64_t deadline_misses = 0;   // Ticks whose work overran the next deadline
+    LatencyHistogram wakeup_latency;     // How late each tick started vs its deadline (ns)
+    LatencyHistogram tick_duration;      // Time spent between wake-up and the next wait (ns)
+};
+
+// Absolute-deadline fixed-rate scheduler for HIL runs.
+// Sleeps with clock_nanosleep(TIMER_ABSTIME) until shortly before each
+// deadline and then busy-waits, which avoids both drift (deadlines never
+// accumulate sleep error) and most of the kernel wake-up jitter.
+class RealTimeScheduler
+{
+public:
+    explicit RealTimeScheduler(const RealTimeConfig &config);
+
+    // Applies CPU pinning / SCHED_FIFO to the calling thread. Best effort:
+    // returns false and describes what failed in error, the loop still runs.
+    bool applyThreadSettings(std::string &error);
+
+    // Sets the first deadline one period from now
+    void start();
+
+    // Blocks until the next deadline and records latency / misses
+    void waitNextTick();
+
+    double period() const { return 1.0 / _config.rate_hz; }
+    const RealTimeStats &stats() const { return _stats; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void sleepUntil(Clock::time_point wake);
+
+    RealTimeConfig _config;
+    Clock::duration _period;
+    Clock::time_point _deadline;
+    Clock::time_point _tick_start;
+    bool _started;
+    RealTimeStats _stats;
+};
+
+// Two-line CSV: Rate,Ticks,DeadlineMisses,LatencyP50Us,LatencyP99Us,LatencyP999Us,LatencyMaxUs,TickP99Us
+void writeRealTimeSummaryCsv(std::ostream &out, const RealTimeConfig &config, const RealTimeStats &stats);
@@ -0,0 +1,131 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include "Controller.hpp"
+#include "ISensor.hpp"
+#include "SensorBase.hpp"
+#include "Telemetry.hpp"
+
+// Read-only memory mapping of a whole file (POSIX mmap), unmapped on destruction.
+// Throws std::runtime_error if the file cannot be opened or mapped.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string &path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const char *data() const { return _data; }
+    std::size_t size() const { return _size; }
+
+private:
+    const char *_data;
+    std::size_t _size;
+};
+
+enum class ReplayFormat
+{
+    Csv,     // Time,Target,Actual,Output text (telemetry.csv)
+    Float32, // Binary telemetry, float32 columns
+    Float64  // Binary telemetry, float64 columns
+};
+
+// Plays recorded telemetry back as altimeter readings: sample i is the file's
+// Actual value at step i. The file is memory-mapped, never loaded. Float64
+// binary files are read in place (zero copy) and float32 ones are widened per
+// sample. CSV is parsed a row at a time straight out of the mapping, skipping
+// blank lines. After the last sample the sensor keeps repeating it, and
+// exhausted() turns true.
+class ReplaySensor final : public ISensor, public SensorBase<ReplaySensor>
+{
+public:
+    // Detects the format from the content. Throws std::runtime_error if the
+    // file is missing, is not telemetry, or (CSV) has a malformed first row.
+    explicit ReplaySensor(const std::string &path);
+
+    // Rewinds to the first sample
+    void init() override;
+    double readValue() override { return sample(); }
+
+    // Up to count samples, with the recorded Time as timestamps
+    std::size_t readBatch(double *values, double *timestamps, std::size_t count) override;
+
+    // Static-dispatch reading used by SensorBase::read()
+    double sample()
+    {
+        if (_pos >= _steps)
+            return _record.actual;
+        if (_format != ReplayFormat::Float64)
+            return nextRecord();
+        _record.actual = _actual[_pos++];
+        return _record.actual;
+    }
+
+    // The whole row of the last sample (float64 files fill time/target/output on demand)
+    TelemetryRecord record() const;
+
+    std::size_t size() const { return _steps; }
+    std::size_t position() const { return _pos; }
+    bool exhausted() const { return _pos >= _steps; }
+    double dt() const { return _dt; } // From the header, or the first two CSV timestamps
+    ReplayFormat format() const { return _format; }
+
+    // Column c (0 = Time, 1 = Target, 2 = Actual, 3 = Output) in place; float64 files only, nullptr otherwise
+    const double *column(std::size_t c) const;
+
+private:
+    double nextRecord();                 // Float32 and CSV paths of sample()
+    bool parseRow(TelemetryRecord &row); // Next non-blank CSV row from _cursor; false when malformed
+
+    MappedFile _file;
+    ReplayFormat _format;
+    std::size_t _steps;
+    std::size_t _pos;
+    double _dt;
+
+    const char *_columns[BinaryTelemetryWriter::kColumnCount]; // Binary column starts
+    const double *_actual;                                      // Float64 Actual column
+    const char *_first_row;                                     // CSV: first data row
+    const char *_cursor;                                        // CSV: next row
+    TelemetryRecord _record;                                    // Last sample's row
+};
+
+// Result of feeding a recording through a controller
+struct ReplayReport
+{
+    std::size_t samples;
+    double max_error;       // Largest |command - recorded Output|
+    double rms_error;
+    std::size_t mismatches; // Samples where the error exceeded the tolerance
+};
+
+// Regression replay: runs every recorded (Target, Actual) pair through the
+// controller and compares its command with the recorded Output. A controller
+// configured like the recording reproduces float64 files exactly.
+template <typename Controller>
+ReplayReport replayController(Controller &controller, ReplaySensor &sensor, double tolerance = 0.0)
+{
+    static_assert(is_controller_v<Controller>, "Controller needs calculate(setpoint, pv) and reset()");
+
+    ReplayReport report{0, 0.0, 0.0, 0};
+    double sum_sq = 0.0;
+    sensor.init();
+    controller.reset();
+    while (!sensor.exhausted())
+    {
+        double pv = sensor.read();
+        TelemetryRecord recorded = sensor.record();
+        double error = std::abs(controller.calculate(recorded.target, pv) - recorded.output);
+
+        report.max_error = std::max(report.max_error, error);
+        sum_sq += error * error;
+        report.mismatches += (error > tolerance) ? 1 : 0;
+        report.samples++;
+    }
+    report.rms_error = (report.samples > 0) ? std::sqrt(sum_sq / report.samples) : 0.0;
+    return report;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include "Metrics.hpp"
+#include "Mission.hpp"
+#include "RunLimits.hpp"
+
+// Content address of one simulation: every input that changes the result
+// (gains, mission, noise model and seed, plant, PID options) serialized into
+// a canonical byte string, plus its 64-bit FNV-1a hash. Extend
+// makeSimulationKey() whenever MissionProfile grows a field.
+struct SimulationKey
+{
+    std::string bytes;
+    std::uint64_t hash;
+};
+
+SimulationKey makeSimulationKey(const PIDGains &gains, const MissionProfile &mission);
+
+// Key of a run flown under divergence limits (rmse_bound is not part of it).
+// A run that completes unlimited may still count as diverged under limits, so
+// bounded and unbounded results must never share an entry.
+SimulationKey makeSimulationKey(const PIDGains &gains, const MissionProfile &mission, const RunLimits &limits);
+
+// 64-bit FNV-1a
+std::uint64_t fnv1a(const void *data, std::size_t size, std::uint64_t hash = 0xcbf29ce484222325ULL);
+
+// Least-recently-used map from SimulationKey to Value. Hash collisions are
+// caught by comparing the full key bytes. Not thread-safe.
+template <typename Value>
+class LruCache
+{
+public:
+    explicit LruCache(std::size_t capacity) : _capacity(capacity) {}
+
+    // Returns the cached value (and marks it most recently used), or nullptr
+    const Value *find(const SimulationKey &key)
+    {
+        auto it = _index.find(key.hash);
+        if (it == _index.end() || it->second->key != key.bytes)
+            return nullptr;
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return &it->second->value;
+    }
+
+    void insert(const SimulationKey &key, const Value &value)
+    {
+        if (_capacity == 0)
+            return;
+
+        auto it = _index.find(key.hash);
+        if (it != _index.end())
+        {
+            it->second->key = key.bytes;
+            it->second->value = value;
+            _entries.splice(_entries.begin(), _entries, it->second);
+            return;
+        }
+
+        if (_entries.size() == _capacity)
+        {
+            _index.erase(_entries.back().hash);
+            _entries.pop_back();
+        }
+        _entries.push_front({key.hash, key.bytes, value});
+        _index[key.hash] = _entries.begin();
+    }
+
+    std::size_t size() const { return _entries.size(); }
+    std::size_t capacity() const { return _capacity; }
+
+    void clear()
+    {
+        _entries.clear();
+        _index.clear();
+    }
+
+private:
+    struct Entry
+    {
+        std::uint64_t hash;
+        std::string key;
+        Value value;
+    };
+
+    std::size_t _capacity;
+    std::list<Entry> _entries; // Most recently used first
+    std::unordered_map<std::uint64_t, typename std::list<Entry>::iterator> _index;
+};
+
+struct ResultCacheStats
+{
+    std::uint64_t hits;      // Served from memory
+    std::uint64_t disk_hits; // Served from the directory (and promoted to memory)
+    std::uint64_t misses;
+};
+
+// Metrics of finished runs, in memory and optionally in a directory that
+// outlives the process (one <hash>.arc file per run)
+class ResultCache
+{
+public:
+    // An empty directory keeps the cache in memory only
+    explicit ResultCache(std::size_t capacity = 4096, const std::string &directory = "");
+
+    bool find(const SimulationKey &key, MetricsSummary &metrics);
+    void store(const SimulationKey &key, const MetricsSummary &metrics);
+
+    const ResultCacheStats &stats() const { return _stats; }
+    std::size_t size() const { return _memory.size(); }
+
+private:
+    std::string pathFor(const SimulationKey &key) const;
+
+    LruCache<MetricsSummary> _memory;
+    std::string _directory;
+    ResultCacheStats _stats;
+};
@@ -0,0 +1,76 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "Metrics.hpp"
+#include "Mission.hpp"
+
+// How a bounded run ended
+enum class RunStatus
+{
+    Completed, // Ran every step
+    CostBound, // Stopped early: its RMSE could no longer get below the bound
+    Diverged   // Stopped early: output pinned at a limit or altitude runaway
+};
+
+struct RunResult
+{
+    MetricsSummary metrics; // Partial metrics when status != Completed
+    RunStatus status;
+    int steps; // Steps actually simulated
+};
+
+// When a run may stop before mission.steps. The defaults never stop it.
+struct RunLimits
+{
+    double rmse_bound = std::numeric_limits<double>::infinity();         // Cost to beat (see Metrics::rmseLowerBound)
+    int max_saturated_steps = 0;                                         // Consecutive steps at an output limit, 0 = off
+    // |target - actual| that counts as runaway, on top of the mission's largest
+    // setpoint step (see RunMonitor), so big steps are not runaways from step 0
+    double max_tracking_error = std::numeric_limits<double>::infinity();
+};
+
+// What the tuners treat as divergence: railed for 100 consecutive steps, or
+// 1 km further off target than the mission's largest setpoint step
+inline RunLimits divergenceLimits()
+{
+    RunLimits limits;
+    limits.max_saturated_steps = 100;
+    limits.max_tracking_error = 1000.0;
+    return limits;
+}
+
+// Per-run early termination check, called once per step after Metrics::update()
+class RunMonitor
+{
+public:
+    RunMonitor(const RunLimits &limits, const MissionProfile &mission)
+        : _limits(limits), _max_output(mission.max_output), _min_output(mission.min_output),
+          _tracking_limit(limits.max_tracking_error + std::max(std::fabs(mission.target1 - mission.initial_altitude),
+                                                               std::fabs(mission.target2 - mission.target1))),
+          _saturated(0)
+    {
+    }
+
+    RunStatus check(const Metrics &metrics, double target, double actual, double output)
+    {
+        // 1. Divergence: the controller has been railed for too long, or the vehicle ran away
+        _saturated = (output >= _max_output || output <= _min_output) ? _saturated + 1 : 0;
+        if (_limits.max_saturated_steps > 0 && _saturated >= _limits.max_saturated_steps)
+            return RunStatus::Diverged;
+        if (!(std::fabs(target - actual) <= _tracking_limit)) // Also catches NaN
+            return RunStatus::Diverged;
+
+        // 2. Cost bound
+        if (metrics.rmseLowerBound() > _limits.rmse_bound)
+            return RunStatus::CostBound;
+        return RunStatus::Completed;
+    }
+
+private:
+    RunLimits _limits;
+    double _max_output;
+    double _min_output;
+    double _tracking_limit; // max_tracking_error plus the largest setpoint step
+    int _saturated;
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <istream>
+#include <string>
+#include <vector>
+#include "Metrics.hpp"
+#include "Mission.hpp"
+#include "Telemetry.hpp"
+
+// A mission described by a scenario file, compiled into flat per-step tables
+// so the loop does an array lookup instead of evaluating segments.
+//
+// Scenario files are line oriented; '#' starts a comment and keywords are:
+//
+//   scenario <name>                       starts a new scenario (the first one may omit it);
+//                                         names are unique and use only letters, digits, '_' and '-'
+//   dt <seconds>                          controller period (default 0.1)
+//   initial <altitude>                    starting altitude (default 0)
+//   limits <min> <max>                    motor output limits (default -500 500)
+//   noise <uniform|gaussian> <amplitude> [seed]
+//   plant <integrator|vehicle> [euler|rk4]  what the output drives (default integrator, rk4)
+//   substeps <n>                          plant steps per control step (physics at n / dt Hz, default 1)
+//   vehicle <mass> <thrust_gain> <max_thrust> <drag> <motor_tau>   VehicleParams (see Plant.hpp)
+//   hold <steps> <altitude>               constant setpoint
+//   ramp <steps> <altitude>               linear from the previous setpoint, reaching <altitude> on the last step
+//   disturbance <start> <steps> <force>   force (motor output units) added over [start, start + steps)
+//
+// Segments run back to back; overlapping disturbances add up. Metrics judge
+// the final segment against its setpoint, like the step-response mission.
+struct Scenario
+{
+    std::string name;
+    MissionProfile mission; // steps, dt, limits, noise, plant, initial altitude; target1/target2/switch_step describe the final segment
+    std::vector<double> setpoint;    // One entry per step
+    std::vector<double> disturbance; // One entry per step
+    int final_segment_start = 0;
+
+    // Metrics for the final segment
+    Metrics metrics() const;
+};
+
+// Parses every scenario in the stream. Throws std::runtime_error("line N: ...") on malformed input.
+std::vector<Scenario> parseScenarios(std::istream &in);
+
+// Same, from a file. Throws std::runtime_error if it cannot be opened.
+std::vector<Scenario> loadScenarios(const std::string &path);
+
+// The two-segment mission as a scenario (same tables targetAt() would give)
+Scenario scenarioFromMission(const MissionProfile &mission, const std::string &name = "mission");
+
+// Flies one scenario with PID gains; telemetry is optional
+MetricsSummary runScenario(const PIDGains &gains, const Scenario &scenario, TelemetryWriter *telemetry = nullptr);
@@ -0,0 +1,27 @@
+#pragma once
+#include <type_traits>
+
+// Static-polymorphism sensor interface (CRTP), for loops that know their
+// sensor types at compile time. read() resolves to Derived::sample() with no
+// virtual dispatch, so it inlines into the loop. Runtime-configured setups
+// keep using ISensor; a sensor can implement both (see MockSensor).
+//
+//   class Baro : public SensorBase<Baro>
+//   {
+//   public:
+//       double sample();  // Required: one reading
+//   };
+template <typename Derived>
+class SensorBase
+{
+public:
+    double read() { return static_cast<Derived &>(*this).sample(); }
+
+protected:
+    // Only usable as a base class
+    SensorBase() = default;
+    ~SensorBase() = default;
+};
+
+template <typename S>
+constexpr bool is_static_sensor_v = std::is_base_of<SensorBase<S>, S>::value;
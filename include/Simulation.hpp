@@ -0,0 +1,37 @@
+#pragma once
+#include <vector>
+#include "Mission.hpp"
+#include "Metrics.hpp"
+#include "RunLimits.hpp"
+
+// In-memory copy of what main.cpp writes to telemetry.csv
+struct MissionTrace
+{
+    std::vector<double> time;
+    std::vector<double> target;
+    std::vector<double> actual;
+    std::vector<double> output;
+};
+
+// Runs the closed loop (PID + MockSensor) in-process, without touching the disk
+MissionTrace simulate(const PIDGains &gains, const MissionProfile &mission);
+
+// Same loop, but only the streaming metrics are kept (no per-step storage)
+MetricsSummary simulateMetrics(const PIDGains &gains, const MissionProfile &mission);
+
+// Simulates a whole population of candidates in one loop pass, stepping all
+// controllers together with PIDBatch. Returns one summary per candidate.
+std::vector<MetricsSummary> simulateBatch(const std::vector<PIDGains> &candidates, const MissionProfile &mission);
+
+// simulateMetrics with early termination (see RunLimits): stops as soon as
+// the run diverges or its RMSE can no longer get below limits.rmse_bound.
+// Since both tuning costs are >= RMSE, passing the cost to beat never
+// discards a winner.
+RunResult simulateBounded(const PIDGains &gains, const MissionProfile &mission, const RunLimits &limits);
+
+// simulateBatch with early abort: lane c stops as soon as its RMSE lower
+// bound (Metrics::rmseLowerBound) exceeds rmse_bounds[c], or it diverges under
+// limits (whose rmse_bound is ignored). The loop ends once every lane has
+// finished or stopped.
+std::vector<RunResult> simulateBatchBounded(const std::vector<PIDGains> &candidates, const MissionProfile &mission,
+                                            const std::vector<double> &rmse_bounds, const RunLimits &limits = RunLimits());
@@ -0,0 +1,52 @@
+#pragma once
+#include <istream>
+#include <ostream>
+#include <string>
+#include "ResultCache.hpp"
+#include "Simulation.hpp"
+#include "TelemetryBuffer.hpp"
+
+// Long-lived simulation service speaking a line protocol, so the GCS can keep
+// one warm flight_controller process instead of spawning one per run.
+//
+// Requests (one per line, whitespace separated):
+//   metrics <kp> <ki> <kd> <steps> <t1> <t2> <switch> [seed]
+//       -> ok <rmse> <overshoot%> <settling_time> <samples>
+//   record <path> <kp> <ki> <kd> <steps> <t1> <t2> <switch> [seed]
+//       -> same as metrics, and writes float64 binary telemetry to <path>
+//   plot <path> <max_points> <kp> <ki> <kd> <steps> <t1> <t2> <switch> [seed]
+//       -> same as record, but <path> holds at most <max_points> min/max-downsampled rows
+//   trace <kp> <ki> <kd> <steps> <t1> <t2> <switch> [seed]
+//       -> ok <rows>, then <rows> lines of Time,Target,Actual,Output, then "end"
+//   tune <steps> <t1> <t2> <switch> <accuracy|balanced> [twiddle|nelder-mead|de|cmaes]
+//       -> ok <kp> <ki> <kd> <cost>
+//   ping -> ok pong
+//   quit -> (closes the session)
+// Malformed requests get "error <reason>" and the session continues.
+//
+// Results are cached: repeated metrics requests (and Twiddle revisits inside
+// tune) come from an LRU of metrics, optionally backed by cache_directory.
+// record/plot/trace fly into one reused TelemetryBuffer, so they allocate
+// nothing after the first (longest) mission, and a repeat of the last run is
+// served straight from it.
+class SimulationServer
+{
+public:
+    explicit SimulationServer(const std::string &cache_directory = "");
+
+    // Serves requests until "quit" or end of input. Returns the number of requests handled.
+    int serve(std::istream &in, std::ostream &out);
+
+    // Handles a single request line. Returns false when the session should end.
+    bool handle(const std::string &line, std::ostream &out);
+
+    const ResultCacheStats &cacheStats() const { return _metrics.stats(); }
+
+private:
+    // Simulated into _trace, or already there; valid until the next call
+    const TelemetryBuffer &trace(const PIDGains &gains, const MissionProfile &mission);
+
+    ResultCache _metrics;
+    TelemetryBuffer _trace;
+    std::string _trace_key; // SimulationKey bytes of the run in _trace, empty if none
+};
@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Bounded lock-free single-producer / single-consumer ring buffer.
+// Exactly one thread may push and exactly one (other) thread may pop.
+template <typename T>
+class SpscRing
+{
+public:
+    // Capacity is rounded up to a power of two
+    explicit SpscRing(std::size_t capacity)
+        : _mask(roundUp(capacity) - 1), _slots(_mask + 1), _head(0), _tail(0)
+    {
+    }
+
+    // Producer side. Returns false (and leaves the ring untouched) when full.
+    bool tryPush(const T &value)
+    {
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) > _mask)
+            return false;
+        _slots[head & _mask] = value;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Moves up to max items into out and returns how many.
+    std::size_t popBulk(T *out, std::size_t max)
+    {
+        const std::size_t tail = _tail.load(std::memory_order_relaxed);
+        std::size_t available = _head.load(std::memory_order_acquire) - tail;
+        std::size_t count = (available < max) ? available : max;
+        for (std::size_t i = 0; i < count; i++)
+            out[i] = _slots[(tail + i) & _mask];
+        _tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Approximate when called concurrently
+    std::size_t size() const { return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire); }
+    std::size_t capacity() const { return _mask + 1; }
+
+private:
+    static std::size_t roundUp(std::size_t n)
+    {
+        std::size_t p = 1;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+
+    const std::size_t _mask;
+    std::vector<T> _slots;
+
+    // Producer and consumer indices live on separate cache lines
+    alignas(64) std::atomic<std::size_t> _head; // Next slot to write
+    alignas(64) std::atomic<std::size_t> _tail; // Next slot to read
+};
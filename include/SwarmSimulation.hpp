@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Metrics.hpp"
+#include "Mission.hpp"
+
+struct SwarmConfig
+{
+    int vehicles = 100;
+    int axes = 3;
+    PIDGains gains = {0.6, 0.01, 0.05};
+    MissionProfile mission;   // Flown by every axis; axis lane l uses noise seed mission.noise.seed + l
+    std::size_t threads = 1;  // Vehicle shards run in parallel (0 = all hardware threads)
+    bool record = false;      // Keep per-lane telemetry for writeTelemetryCsv()
+};
+
+// Steps every axis of every vehicle per tick, with vehicle, sensor and
+// controller state in structure-of-arrays form (one lane per vehicle axis).
+// Shards of vehicles are independent, so they run on separate threads with
+// no per-tick synchronization. Each lane reproduces simulateMetrics() with
+// the same seed bit for bit.
+class SwarmSimulation
+{
+public:
+    // Throws std::invalid_argument unless vehicles and axes are both positive
+    explicit SwarmSimulation(const SwarmConfig &config);
+
+    void run();
+
+    std::size_t lanes() const { return _lanes; }
+    std::size_t lane(int vehicle, int axis) const { return static_cast<std::size_t>(vehicle) * _config.axes + axis; }
+
+    // One summary per lane, valid after run()
+    const std::vector<MetricsSummary> &metrics() const { return _metrics; }
+
+    // Vehicle,Axis,Time,Target,Actual,Output (the telemetry.csv columns keyed by
+    // vehicle and axis). Requires config.record.
+    void writeTelemetryCsv(const std::string &path) const;
+
+private:
+    void runShard(std::size_t begin, std::size_t end);
+
+    SwarmConfig _config;
+    std::size_t _lanes;
+    std::vector<MetricsSummary> _metrics;
+    std::vector<double> _actual; // [lane * steps + step] when recording
+    std::vector<double> _output;
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "Metrics.hpp"
+#include "Mission.hpp"
+#include "Tuner.hpp"
+
+// Evenly spaced values for one gain, both ends included
+struct GainRange
+{
+    double min;
+    double max;
+    int count;
+
+    double at(int i) const { return (count <= 1) ? min : min + (max - min) * i / (count - 1); }
+};
+
+struct SweepConfig
+{
+    GainRange kp = {0.0, 2.0, 11};
+    GainRange ki = {0.0, 0.1, 11};
+    GainRange kd = {0.0, 0.2, 11};
+    TuningStrategy strategy = TuningStrategy::Accuracy;
+    std::size_t threads = 0; // 0 = all hardware threads
+    std::size_t chunk = 16;  // Candidates per pool task (simulated together with PIDBatch)
+};
+
+struct SweepResult
+{
+    PIDGains gains;
+    MetricsSummary metrics;
+    double cost;
+};
+
+// Simulates every Kp x Ki x Kd combination on a work-stealing pool and
+// returns the results ranked from lowest to highest cost
+std::vector<SweepResult> runSweep(const MissionProfile &mission, const SweepConfig &config);
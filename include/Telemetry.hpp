@@ -0,0 +1,138 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Simulation.hpp"
+
+// One row of telemetry (same columns as telemetry.csv)
+struct TelemetryRecord
+{
+    double time;
+    double target;
+    double actual;
+    double output;
+};
+
+// Destination for the per-step telemetry of a run
+class TelemetryWriter
+{
+public:
+    virtual ~TelemetryWriter() {}
+
+    virtual void write(const TelemetryRecord &record) = 0;
+
+    // Writes count consecutive records (override when a block can be written at once)
+    virtual void writeBlock(const TelemetryRecord *records, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+            write(records[i]);
+    }
+
+    // Flushes everything to disk; further writes are ignored
+    virtual void close() = 0;
+};
+
+// Time,Target,Actual,Output text file (what app.py has always read)
+class CsvTelemetryWriter : public TelemetryWriter
+{
+public:
+    explicit CsvTelemetryWriter(const std::string &path);
+    ~CsvTelemetryWriter() override;
+
+    void write(const TelemetryRecord &record) override;
+    void writeBlock(const TelemetryRecord *records, std::size_t count) override;
+    void close() override;
+
+private:
+    std::ofstream _file;
+    std::ostringstream _block; // Formatting buffer reused by writeBlock()
+};
+
+// Sends every record to two writers (e.g. the telemetry file and a live publisher)
+class TeeTelemetryWriter : public TelemetryWriter
+{
+public:
+    TeeTelemetryWriter(std::unique_ptr<TelemetryWriter> first, std::unique_ptr<TelemetryWriter> second);
+
+    void write(const TelemetryRecord &record) override;
+    void writeBlock(const TelemetryRecord *records, std::size_t count) override;
+    void close() override;
+
+    TelemetryWriter &first() { return *_first; }
+    TelemetryWriter &second() { return *_second; }
+
+private:
+    std::unique_ptr<TelemetryWriter> _first;
+    std::unique_ptr<TelemetryWriter> _second;
+};
+
+// Binary columnar telemetry (.bin), little-endian:
+//
+//   offset  size  field
+//   0       8     magic "AEROTLM\0"
+//   8       4     version (uint32, currently 1)
+//   12      4     value size in bytes (uint32, 4 = float32, 8 = float64)
+//   16      4     column count (uint32)
+//   20      4     header size in bytes = offset of the first column (uint32)
+//   24      8     dt (float64)
+//   32      8     step count (uint64)
+//   40      24    reserved (zero)
+//   64      16*N  column names, NUL padded ("Time", "Target", "Actual", "Output")
+//
+// followed by each column as step_count contiguous values. The column data is
+// 8-byte aligned, so numpy.memmap can map every column without parsing.
+enum class TelemetryPrecision
+{
+    Float32,
+    Float64
+};
+
+class BinaryTelemetryWriter : public TelemetryWriter
+{
+public:
+    // expected_steps only sizes the buffers; the real count goes into the header
+    BinaryTelemetryWriter(const std::string &path, double dt, std::size_t expected_steps,
+                          TelemetryPrecision precision = TelemetryPrecision::Float64);
+    ~BinaryTelemetryWriter() override;
+
+    void write(const TelemetryRecord &record) override;
+    void close() override;
+
+    static const std::uint32_t kVersion = 1;
+    static const std::uint32_t kHeaderSize = 64;
+    static const std::uint32_t kColumnNameSize = 16;
+    static const std::uint32_t kColumnCount = 4;
+
+private:
+    template <typename T>
+    void writeColumns();
+
+    std::string _path;
+    double _dt;
+    TelemetryPrecision _precision;
+    std::vector<double> _columns[kColumnCount]; // Time, Target, Actual, Output
+    bool _closed;
+};
+
+// Where the columns of a binary telemetry image live, for readers that map the
+// file instead of loading it (see ReplaySensor). Column c starts at
+// data + header_size + c * steps * value_size.
+struct BinaryTelemetryLayout
+{
+    std::uint32_t value_size; // 4 = float32, 8 = float64
+    std::uint32_t header_size;
+    double dt;
+    std::uint64_t steps;
+};
+
+// Validates the header of a size-byte telemetry image. Returns false if it is
+// not a binary telemetry file, has an unsupported layout, a header size that
+// leaves the columns misaligned for double, or is truncated.
+bool parseBinaryTelemetryHeader(const void *data, std::size_t size, BinaryTelemetryLayout &layout);
+
+// Loads a binary telemetry file back into memory (either precision).
+// Throws std::runtime_error if the file is missing or not a telemetry file.
+MissionTrace readBinaryTelemetry(const std::string &path, double *dt = nullptr);
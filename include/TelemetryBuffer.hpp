@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include "Simulation.hpp"
+#include "Telemetry.hpp"
+
+// In-memory telemetry backed by one preallocated arena: the four columns
+// (Time, Target, Actual, Output) live back to back in a single block sized
+// from the mission's step count. reset() keeps the block, so a buffer reused
+// across runs (tuner, sweep, server) allocates once and never again, and
+// write() in the loop never touches the heap.
+class TelemetryBuffer : public TelemetryWriter
+{
+public:
+    explicit TelemetryBuffer(std::size_t capacity = 0);
+
+    // Makes room for steps records. Only reallocates (dropping the contents)
+    // when the arena is too small.
+    void reserve(std::size_t steps);
+
+    // Forgets the records (and the dropped count) but keeps the arena
+    void reset()
+    {
+        _size = 0;
+        _dropped = 0;
+    }
+
+    // Appends a record; records beyond capacity() are counted in dropped()
+    void write(const TelemetryRecord &record) override
+    {
+        if (_size == _capacity)
+        {
+            _dropped++;
+            return;
+        }
+        _time[_size] = record.time;
+        _target[_size] = record.target;
+        _actual[_size] = record.actual;
+        _output[_size] = record.output;
+        _size++;
+    }
+
+    void close() override {}
+
+    std::size_t size() const { return _size; }
+    std::size_t capacity() const { return _capacity; }
+    std::size_t dropped() const { return _dropped; }
+
+    // Number of times the arena was (re)allocated
+    std::size_t allocations() const { return _allocations; }
+
+    const double *time() const { return _time; }
+    const double *target() const { return _target; }
+    const double *actual() const { return _actual; }
+    const double *output() const { return _output; }
+
+    // Copy into the vector-based trace (allocates)
+    MissionTrace toTrace() const;
+
+private:
+    std::unique_ptr<double[]> _arena;
+    std::size_t _capacity;
+    std::size_t _size;
+    std::size_t _dropped;
+    std::size_t _allocations;
+    double *_time;
+    double *_target;
+    double *_actual;
+    double *_output;
+};
+
+// simulate() into a reusable buffer: reserves mission.steps, resets, then
+// runs the loop without any heap allocation once the arena is big enough
+void simulate(const PIDGains &gains, const MissionProfile &mission, TelemetryBuffer &buffer);
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include "Telemetry.hpp"
+
+// How DownsamplingTelemetryWriter reduces a run to its point budget
+enum class DownsampleMode
+{
+    Decimate, // Keep every stride-th record
+    MinMax    // Keep the lowest and highest Actual of each bucket (peaks survive)
+};
+
+// Writes at most max_points of a run's records to the wrapped writer, so the
+// dashboard parses what it plots instead of every step. Metrics are computed
+// from the full-rate loop and are not affected.
+//
+// MinMax splits the run into buckets of ceil(2 * steps / max_points) records
+// and emits each bucket's minimum and maximum (in time order, once if they
+// coincide), which keeps overshoot peaks and noise envelope visible. With a
+// max_points of 1 it decimates instead, so the budget always holds.
+class DownsamplingTelemetryWriter : public TelemetryWriter
+{
+public:
+    // expected_steps is the run length the stride is computed from; a
+    // max_points of 0, or one >= expected_steps, passes every record through
+    DownsamplingTelemetryWriter(std::unique_ptr<TelemetryWriter> backend, std::size_t expected_steps,
+                                std::size_t max_points, DownsampleMode mode = DownsampleMode::MinMax);
+    ~DownsamplingTelemetryWriter() override;
+
+    void write(const TelemetryRecord &record) override;
+
+    // Emits the partial last bucket and closes the backend
+    void close() override;
+
+    // Records per output point (Decimate) or per bucket (MinMax)
+    std::size_t stride() const { return _stride; }
+    std::size_t emitted() const { return _emitted; }
+
+private:
+    void flushBucket();
+
+    std::unique_ptr<TelemetryWriter> _backend;
+    DownsampleMode _mode;
+    std::size_t _stride;
+    std::size_t _counter;
+    std::size_t _emitted;
+    bool _closed;
+
+    // Current MinMax bucket
+    std::size_t _bucket_fill;
+    TelemetryRecord _min, _max;
+    std::size_t _min_index, _max_index;
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include "SpscRing.hpp"
+#include "Telemetry.hpp"
+
+// What the control loop does when the ring buffer is full
+enum class OverflowPolicy
+{
+    Block, // Backpressure: wait for the writer thread to make room (no data lost)
+    Drop   // Discard the new record and count it (the loop never waits)
+};
+
+struct TelemetrySinkStats
+{
+    std::uint64_t pushed;     // Records accepted into the ring
+    std::uint64_t written;    // Records handed to the backend writer
+    std::uint64_t dropped;    // Records discarded under OverflowPolicy::Drop
+    std::uint64_t stalls;     // Times the loop found the ring full
+    std::uint64_t high_water; // Largest ring occupancy seen by the writer thread
+};
+
+// Asynchronous telemetry: the control loop pushes fixed-size records into a
+// lock-free SPSC ring and a background thread formats and writes them to the
+// wrapped writer in large blocks, keeping file I/O off the loop thread.
+class TelemetrySink : public TelemetryWriter
+{
+public:
+    TelemetrySink(std::unique_ptr<TelemetryWriter> backend, std::size_t capacity = 16384,
+                  OverflowPolicy policy = OverflowPolicy::Block, std::size_t block = 1024);
+    ~TelemetrySink() override;
+
+    // Called from the control loop thread only; after close() records are dropped
+    void write(const TelemetryRecord &record) override;
+
+    // Drains the ring, stops the writer thread and closes the backend
+    void close() override;
+
+    TelemetrySinkStats stats() const;
+
+private:
+    void run();
+
+    std::unique_ptr<TelemetryWriter> _backend;
+    SpscRing<TelemetryRecord> _ring;
+    OverflowPolicy _policy;
+    std::size_t _block;
+
+    std::atomic<bool> _stop;
+    std::atomic<std::uint64_t> _pushed;
+    std::atomic<std::uint64_t> _written;
+    std::atomic<std::uint64_t> _dropped;
+    std::atomic<std::uint64_t> _stalls;
+    std::atomic<std::uint64_t> _high_water;
+
+    std::thread _thread;
+};
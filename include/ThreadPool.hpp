@@ -0,0 +1,56 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size work-stealing thread pool.
+// Every worker owns a task deque; idle workers steal from the others, so
+// uneven simulations (e.g. early-diverging candidates) still balance out.
+class ThreadPool
+{
+public:
+    // threads = 0 uses one worker per hardware thread
+    explicit ThreadPool(std::size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    void submit(std::function<void()> task);
+
+    // Blocks until every submitted task has finished
+    void wait();
+
+    // Splits [0, count) into chunks of at most grain items and runs
+    // body(begin, end) for each chunk on the pool, then waits
+    void parallelFor(std::size_t count, std::size_t grain, const std::function<void(std::size_t, std::size_t)> &body);
+
+    std::size_t size() const { return _threads.size(); }
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void workerLoop(std::size_t index);
+    bool tryTake(std::size_t index, std::function<void()> &task);
+
+    std::vector<std::unique_ptr<Queue>> _queues;
+    std::vector<std::thread> _threads;
+
+    std::mutex _mutex;                 // Guards sleeping/waking
+    std::condition_variable _work;     // Signalled when tasks are queued or on shutdown
+    std::condition_variable _finished; // Signalled when _pending drops to zero
+    std::size_t _queued;               // Tasks sitting in any queue (guarded by _mutex)
+    std::atomic<std::size_t> _pending; // Tasks submitted but not finished
+    std::atomic<std::size_t> _next;    // Round-robin target for submit()
+    bool _stop;
+};
@@ -0,0 +1,76 @@
+#pragma once
+#include <array>
+#include <limits>
+#include "Metrics.hpp"
+#include "ResultCache.hpp"
+#include "RunLimits.hpp"
+#include "Simulation.hpp"
+
+// Same two cost functions the GCS offers
+enum class TuningStrategy
+{
+    Accuracy, // Cost = RMSE
+    Balanced  // Cost = RMSE + settling time penalty
+};
+
+// Cost of a run under the given strategy (infinite settling time costs a flat penalty)
+double missionCost(const MetricsSummary &metrics, TuningStrategy strategy);
+
+struct TunerConfig
+{
+    TuningStrategy strategy = TuningStrategy::Accuracy;
+    std::array<double, 3> initial = {0.5, 0.0, 0.0}; // Starting Kp, Ki, Kd
+    std::array<double, 3> step = {0.1, 0.01, 0.01};  // Initial search step per gain
+    double threshold = 0.005;                        // Stop when sum(step) drops below this
+    int max_iterations = 30;
+
+    // Stop candidates that cannot beat the best cost so far or that diverged
+    // (limits.rmse_bound is set per candidate). The RMSE bound never changes
+    // the result; the divergence limits do, by scoring such candidates inf.
+    bool early_termination = true;
+    RunLimits limits = divergenceLimits();
+
+    // Finished runs are remembered, so revisited gain triples cost nothing.
+    // A shared cache (e.g. the server's, possibly disk-backed) replaces the
+    // tuner's own one of cache_capacity entries (0 = no caching). With early
+    // termination, entries are keyed by the limits too, so full-run results
+    // stored by others never stand in for a run these limits would stop.
+    std::size_t cache_capacity = 1024;
+    ResultCache *cache = nullptr;
+};
+
+struct TuningResult
+{
+    PIDGains gains;
+    double cost;
+    int evaluations; // Number of simulations that were run
+    int aborted = 0;    // Of those, how many were stopped early by a cost bound
+    int cache_hits = 0; // Candidates answered from the result cache instead
+};
+
+// Twiddle (coordinate descent) auto-tuner, running every candidate in-process
+class Tuner
+{
+public:
+    Tuner(const MissionProfile &mission, const TunerConfig &config);
+
+    // Runs the full optimization and returns the best gains found
+    TuningResult run();
+
+    // Simulates one candidate and returns its cost. With early termination a
+    // candidate that provably costs more than bound, or diverges, costs infinity.
+    double evaluate(const PIDGains &gains, double bound = std::numeric_limits<double>::infinity());
+
+    // Steps simulated by the last run() (or evaluate() calls since)
+    long long simulatedSteps() const { return _steps; }
+
+private:
+    MissionProfile _mission;
+    TunerConfig _config;
+    int _evaluations;
+    int _aborted;
+    int _cache_hits;
+    long long _steps;
+    ResultCache _own_cache;
+    ResultCache *_cache;
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "Telemetry.hpp"
+
+// Live telemetry over UDP (unicast or multicast), little-endian datagrams:
+//
+//   offset  size  field
+//   0       4     magic "ATLP"
+//   4       2     version (uint16, currently 1)
+//   6       2     record count in this packet (uint16, <= kRecordsPerPacket)
+//   8       4     sequence number (uint32, +1 per packet, for loss detection)
+//   12      2     flags (uint16, kFlagLast on the final packet of a run)
+//   14      2     decimation factor (uint16)
+//   16      32*N  records: Time, Target, Actual, Output as float64
+//
+// Every decimation-th record is published; the rest only go to the file.
+// Sends never block the control loop: a full socket buffer drops the packet,
+// which the receiver sees as a sequence gap.
+struct TelemetryPacketHeader
+{
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t count;
+    std::uint32_t sequence;
+    std::uint16_t flags;
+    std::uint16_t decimation;
+};
+static_assert(sizeof(TelemetryPacketHeader) == 16, "Packet header layout must stay 16 bytes");
+
+struct UdpPublisherStats
+{
+    std::uint64_t records;     // Records published (after decimation)
+    std::uint64_t packets;     // Datagrams sent
+    std::uint64_t send_errors; // Datagrams the socket refused (dropped)
+};
+
+class UdpTelemetryPublisher : public TelemetryWriter
+{
+public:
+    // host may be a name, a unicast or a multicast (224.0.0.0/4) address.
+    // Throws std::runtime_error if the address cannot be resolved, and
+    // std::invalid_argument if decimation does not fit the header's uint16.
+    UdpTelemetryPublisher(const std::string &host, std::uint16_t port, unsigned decimation = 1);
+    ~UdpTelemetryPublisher() override;
+
+    void write(const TelemetryRecord &record) override;
+
+    // Sends the partial packet flagged kFlagLast and closes the socket
+    void close() override;
+
+    const UdpPublisherStats &stats() const { return _stats; }
+
+    static constexpr std::uint16_t kVersion = 1;
+    static constexpr std::uint16_t kFlagLast = 1;
+    static constexpr std::size_t kRecordsPerPacket = 32; // 1040-byte datagrams, below a 1500-byte MTU
+
+private:
+    void sendPacket(std::uint16_t flags);
+
+    int _socket;
+    alignas(8) unsigned char _address[128]; // sockaddr_storage of the destination
+    unsigned _address_length;
+    unsigned _decimation;
+    std::uint64_t _counter; // Records seen, for decimation
+    std::uint32_t _sequence;
+    std::size_t _pending;
+    TelemetryRecord _records[kRecordsPerPacket];
+    UdpPublisherStats _stats;
+};
+
+// Parses "host:port" (e.g. "239.0.0.1:14550"). Returns false if malformed.
+bool parseHostPort(const std::string &text, std::string &host, std::uint16_t &port);
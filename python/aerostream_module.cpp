@@ -0,0 +1,131 @@
+// Python bindings for ControlLogic (built with -DAEROSTREAM_BUILD_PYTHON=ON)
+//
+//   import aerostream
+//   run = aerostream.simulate(0.6, 0.01, 0.05, steps=1000, target1=50, target2=100, switch_step=300)
+//   run["Actual"]   # numpy.ndarray viewing the C++ buffer, no copy
+//
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "Metrics.hpp"
+#include "MockSensor.hpp"
+#include "PID.hpp"
+#include "Simulation.hpp"
+#include "TelemetryBuffer.hpp"
+#include "Tuner.hpp"
+
+namespace py = pybind11;
+
+namespace
+{
+    MissionProfile makeMission(int steps, double target1, double target2, int switch_step, std::uint64_t seed)
+    {
+        MissionProfile mission;
+        mission.steps = steps;
+        mission.target1 = target1;
+        mission.target2 = target2;
+        mission.switch_step = switch_step;
+        mission.noise.seed = seed;
+        return mission;
+    }
+
+    // Wraps one buffer column as an ndarray; the capsule keeps the whole arena alive
+    py::array_t<double> column(const double *data, std::size_t size, const py::capsule &owner)
+    {
+        return py::array_t<double>({size}, {sizeof(double)}, data, owner);
+    }
+
+    py::dict metricsDict(const MetricsSummary &m)
+    {
+        py::dict result;
+        result["rmse"] = m.rmse;
+        result["overshoot"] = m.overshoot_percent;
+        result["settling_time"] = m.settling_time;
+        result["samples"] = m.samples;
+        return result;
+    }
+}
+
+PYBIND11_MODULE(aerostream, m)
+{
+    m.doc() = "AeroStream ControlLogic: PID, MockSensor and in-process mission simulation";
+
+    py::class_<PID>(m, "PID")
+        .def(py::init<double, double, double, double, double, double>(),
+             py::arg("kp"), py::arg("ki"), py::arg("kd"), py::arg("dt"), py::arg("max_output"), py::arg("min_output"))
+        .def("calculate", &PID::calculate, py::arg("setpoint"), py::arg("pv"))
+        .def("reset", &PID::reset);
+
+    py::enum_<NoiseDistribution>(m, "NoiseDistribution")
+        .value("Uniform", NoiseDistribution::Uniform)
+        .value("Gaussian", NoiseDistribution::Gaussian);
+
+    py::class_<MockSensor>(m, "MockSensor")
+        .def(py::init([](double initial_value, NoiseDistribution distribution, double amplitude, std::uint64_t seed) {
+                 return MockSensor(initial_value, SensorNoise{distribution, amplitude, seed});
+             }),
+             py::arg("initial_value") = 0.0, py::arg("distribution") = NoiseDistribution::Uniform,
+             py::arg("amplitude") = 0.5, py::arg("seed") = 1)
+        .def("read_value", &MockSensor::readValue)
+        .def("update", &MockSensor::update, py::arg("step_value"))
+        .def("reseed", &MockSensor::reseed, py::arg("seed"))
+        .def("fill_noise", [](MockSensor &sensor, py::array_t<double, py::array::c_style> out) {
+            sensor.fillNoise(out.mutable_data(), static_cast<std::size_t>(out.size()));
+        }, py::arg("out"));
+
+    m.def("simulate", [](double kp, double ki, double kd, int steps, double target1, double target2, int switch_step,
+                         std::uint64_t seed) {
+        MissionProfile mission = makeMission(steps, target1, target2, switch_step, seed);
+
+        // The arrays outlive the call, so every run gets its own buffer: one
+        // arena sized from steps, instead of four growing vectors
+        TelemetryBuffer *buffer;
+        MetricsSummary summary;
+        {
+            py::gil_scoped_release release;
+            buffer = new TelemetryBuffer();
+            simulate({kp, ki, kd}, mission, *buffer);
+
+            Metrics metrics(mission);
+            for (std::size_t i = 0; i < buffer->size(); i++)
+                metrics.update(static_cast<int>(i), buffer->target()[i], buffer->actual()[i]);
+            summary = metrics.summary();
+        }
+        py::capsule owner(buffer, [](void *p) { delete static_cast<TelemetryBuffer *>(p); });
+
+        // Same keys as the telemetry.csv columns, so pandas.DataFrame(run) just works
+        py::dict run;
+        run["Time"] = column(buffer->time(), buffer->size(), owner);
+        run["Target"] = column(buffer->target(), buffer->size(), owner);
+        run["Actual"] = column(buffer->actual(), buffer->size(), owner);
+        run["Output"] = column(buffer->output(), buffer->size(), owner);
+        run["metrics"] = metricsDict(summary);
+        return run;
+    }, py::arg("kp"), py::arg("ki"), py::arg("kd"), py::arg("steps") = 1000, py::arg("target1") = 50.0,
+       py::arg("target2") = 100.0, py::arg("switch_step") = 500, py::arg("seed") = 1,
+       "Runs one mission and returns its telemetry columns (zero-copy) plus metrics");
+
+    m.def("simulate_metrics", [](double kp, double ki, double kd, int steps, double target1, double target2,
+                                 int switch_step, std::uint64_t seed) {
+        MissionProfile mission = makeMission(steps, target1, target2, switch_step, seed);
+        MetricsSummary summary;
+        {
+            py::gil_scoped_release release;
+            summary = simulateMetrics({kp, ki, kd}, mission);
+        }
+        return metricsDict(summary);
+    }, py::arg("kp"), py::arg("ki"), py::arg("kd"), py::arg("steps") = 1000, py::arg("target1") = 50.0,
+       py::arg("target2") = 100.0, py::arg("switch_step") = 500, py::arg("seed") = 1);
+
+    m.def("tune", [](int steps, double target1, double target2, int switch_step, const std::string &strategy) {
+        MissionProfile mission = makeMission(steps, target1, target2, switch_step, 1);
+        TunerConfig config;
+        config.strategy = (strategy == "balanced") ? TuningStrategy::Balanced : TuningStrategy::Accuracy;
+
+        TuningResult result;
+        {
+            py::gil_scoped_release release;
+            result = Tuner(mission, config).run();
+        }
+        return py::make_tuple(result.gains.kp, result.gains.ki, result.gains.kd, result.cost);
+    }, py::arg("steps"), py::arg("target1"), py::arg("target2"), py::arg("switch_step"), py::arg("strategy") = "accuracy");
+}
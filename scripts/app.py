@@ -7,6 +7,8 @@ import os
 import numpy as np
 import subprocess
 import sys
+from telemetry_reader import load_binary_dataframe
+from telemetry_udp import TelemetryReceiver
 
 # --- 1. ROBUST PATH CONFIGURATION ---
 # We calculate absolute paths so this works on Local, Docker, and Cloud
@@ -14,7 +16,10 @@ SCRIPTS_DIR = os.path.dirname(os.path.abspath(__file__))
 ROOT_DIR = os.path.abspath(os.path.join(SCRIPTS_DIR, ".."))
 BUILD_DIR = os.path.join(ROOT_DIR, "build")
 EXE_PATH = os.path.join(BUILD_DIR, "flight_controller")
-CSV_PATH = os.path.join(BUILD_DIR, "telemetry.csv")
+BIN_PATH = os.path.join(BUILD_DIR, "telemetry.bin")
+LIVE_PORT = 14550
+MISSION_DT = 0.1         # MissionProfile::dt
+MAX_PLOT_POINTS = 2000   # Telemetry rows per run the server writes for plotting
 
 # --- 2. AUTO-COMPILE C++ (CLOUD SUPPORT) ---
 def ensure_cpp_executable():
@@ -36,110 +41,94 @@ ensure_cpp_executable()
 st.set_page_config(page_title="AeroStream GCS", layout="wide", page_icon="🚁")
 st.title("🚁 AeroStream: Multi-Mode PID Flight Control")
 
-# --- PHYSICS METRICS ENGINE ---
-def calculate_metrics(df, switch_step, mode_type, tolerance_percent=0.02):
-    if mode_type == "Standard Takeoff":
-        segment = df 
-        target = segment['Target'].iloc[-1]
-        start_val = 0.0 
-    else:
-        switch_idx = int(switch_step)
-        if switch_idx >= len(df): switch_idx = 0
-        segment = df.iloc[switch_idx:].copy()
-        target = segment['Target'].iloc[0]
-        start_val = df['Target'].iloc[0] 
-
-    # 1. RMSE
-    error_series = segment['Target'] - segment['Actual']
-    rmse = np.sqrt((error_series ** 2).mean())
-
-    # 2. Overshoot
-    max_alt = segment['Actual'].max()
-    min_alt = segment['Actual'].min()
-    
-    if target > start_val: 
-        overshoot = max(0, max_alt - target)
-    else: 
-        overshoot = max(0, target - min_alt)
-        
-    overshoot_percent = (overshoot / target) * 100 if target != 0 else 0
-
-    # 3. Settling Time
-    upper_bound = target * (1 + tolerance_percent)
-    lower_bound = target * (1 - tolerance_percent)
-
-    out_of_band = segment[(segment['Actual'] > upper_bound) | (segment['Actual'] < lower_bound)]
-    
-    if out_of_band.empty:
-        settling_time = 0.0
-    else:
-        settling_time = out_of_band['Time'].iloc[-1] - segment['Time'].iloc[0]
-        if out_of_band['Time'].iloc[-1] == segment['Time'].iloc[-1]:
-            settling_time = float('inf')
+# --- SIMULATION SERVER ---
+# One warm "flight_controller serve" process per Streamlit server. Requests and
+# replies are single lines (see include/SimulationServer.hpp).
+@st.cache_resource
+def get_sim_server():
+    return subprocess.Popen(
+        [EXE_PATH, "serve"], cwd=BUILD_DIR,
+        stdin=subprocess.PIPE, stdout=subprocess.PIPE, text=True, bufsize=1
+    )
 
-    return rmse, overshoot_percent, settling_time
+def sim_request(*args):
+    server = get_sim_server()
+    if server.poll() is not None:  # Crashed or killed: start a fresh one
+        get_sim_server.clear()
+        server = get_sim_server()
+    server.stdin.write(" ".join(str(a) for a in args) + "\n")
+    server.stdin.flush()
+    reply = server.stdout.readline().split()
+    if not reply or reply[0] != "ok":
+        raise RuntimeError(" ".join(reply) or "simulation server closed")
+    return reply[1:]
+
+# --- NATIVE MODULE (OPTIONAL) ---
+# When built with -DAEROSTREAM_BUILD_PYTHON=ON the aerostream extension lives
+# next to flight_controller and is called directly: no process, no files.
+sys.path.insert(0, BUILD_DIR)
+try:
+    import aerostream
+except ImportError:
+    aerostream = None
 
-# --- HELPER: Run Simulation ---
-def run_simulation_headless(kp, ki, kd, steps, t1, t2, switch, mission_mode, opt_strategy):    
+# --- PHYSICS METRICS ENGINE ---
+# RMSE, overshoot and settling time are accumulated by the C++ loop while it
+# flies. Returns the telemetry DataFrame plus (rmse, overshoot, settling_time).
+def run_mission(kp, ki, kd, steps, t1, t2, switch):
+    if aerostream is not None:
+        run = aerostream.simulate(kp, ki, kd, steps=steps, target1=t1, target2=t2, switch_step=switch)
+        m = run.pop("metrics")
+        return pd.DataFrame(run, copy=False), (m["rmse"], m["overshoot"], m["settling_time"])
+
+    # "plot" writes at most MAX_PLOT_POINTS min/max-downsampled rows of binary
+    # telemetry for us to memory-map; the metrics still come from every step
+    rmse, overshoot, settling_time, _ = sim_request("plot", BIN_PATH, MAX_PLOT_POINTS, kp, ki, kd, steps, t1, t2, switch)
+    return load_binary_dataframe(BIN_PATH), (float(rmse), float(overshoot), float(settling_time))
+
+# --- LIVE VIEW ---
+# Flies the mission at wall-clock pace (--realtime at 1/dt = 10 Hz, so the
+# physics match run_mission) and plots the UDP telemetry as it arrives.
+def stream_live_mission(kp, ki, kd, steps, t1, t2, switch, decimate=1):
+    receiver = TelemetryReceiver(LIVE_PORT, host="127.0.0.1")
+    proc = subprocess.Popen(
+        [EXE_PATH, *(str(v) for v in (kp, ki, kd, steps, t1, t2, switch)), "--realtime", "--rate=10",
+         f"--udp=127.0.0.1:{LIVE_PORT}", f"--decimate={decimate}"],
+        cwd=BUILD_DIR, stdout=subprocess.DEVNULL
+    )
+    chart = st.empty()
+    chunks = []
     try:
-        # Use the absolute EXE_PATH we defined at the top
-        subprocess.run(
-            [EXE_PATH, str(kp), str(ki), str(kd), str(steps), str(t1), str(t2), str(switch)], 
-            cwd=BUILD_DIR, check=True, stdout=subprocess.DEVNULL
-        )
-    except Exception as e:
-        return float('inf')
-
-    if not os.path.exists(CSV_PATH): return float('inf')
-    
-    df = pd.read_csv(CSV_PATH)
-    rmse, _, settling_time = calculate_metrics(df, switch, mission_mode)
-    
-    if opt_strategy == "accuracy":
-        return rmse 
-    else:
-        if settling_time == float('inf'):
-            time_penalty = 100.0
-        else:
-            time_penalty = settling_time * 0.5 
-        return rmse + time_penalty
+        while not receiver.finished and (proc.poll() is None or chunks):
+            records = receiver.poll(0.25)
+            if len(records) == 0:
+                if proc.poll() is not None:
+                    break
+                continue
+            chunks.append(records)
+            live = np.concatenate(chunks)
+            chart.line_chart(pd.DataFrame({"Target": live["Target"], "Actual": live["Actual"]}, index=live["Time"]))
+    finally:
+        proc.wait()
+        receiver.close()
+    if receiver.lost:
+        st.caption(f"📡 {receiver.lost} telemetry packets lost")
 
 # --- OPTIMIZATION ALGO ---
+# Twiddle runs natively inside the simulation server, so the whole search is
+# one request that returns only the final gains and cost.
 def optimize_pid(progress_bar, t1, t2, switch, steps, mission_mode, opt_strategy):
-    p = [0.5, 0.0, 0.0] 
-    dp = [0.1, 0.01, 0.01] 
-    
-    best_err = run_simulation_headless(p[0], p[1], p[2], steps, t1, t2, switch, mission_mode, opt_strategy)
-    
-    threshold = 0.005
-    iteration = 0
-    max_iter = 30 
-    
-    while sum(dp) > threshold and iteration < max_iter:
-        for i in range(len(p)):
-            p[i] += dp[i]
-            if p[i] < 0: p[i] = 0 
-            
-            err = run_simulation_headless(p[0], p[1], p[2], steps, t1, t2, switch, mission_mode, opt_strategy)
-            
-            if err < best_err:
-                best_err = err
-                dp[i] *= 1.1
-            else:
-                p[i] -= 2 * dp[i]
-                if p[i] < 0: p[i] = 0
-                err = run_simulation_headless(p[0], p[1], p[2], steps, t1, t2, switch, mission_mode, opt_strategy)
-                
-                if err < best_err:
-                    best_err = err
-                    dp[i] *= 1.1
-                else:
-                    p[i] += dp[i]
-                    dp[i] *= 0.9
-            iteration += 1
-            progress_bar.progress(min(iteration / max_iter, 1.0))
-            
-    return p, best_err
+    try:
+        if aerostream is not None:
+            kp, ki, kd, cost = aerostream.tune(steps, t1, t2, switch, opt_strategy)
+        else:
+            kp, ki, kd, cost = (float(v) for v in sim_request("tune", steps, t1, t2, switch, opt_strategy))
+    except Exception as e:
+        st.sidebar.error(f"Tuner failed: {e}")
+        return [st.session_state['kp'], st.session_state['ki'], st.session_state['kd']], float('inf')
+
+    progress_bar.progress(1.0)
+    return [kp, ki, kd], cost
 
 def clamp(n, minn, maxn): return max(min(maxn, n), minn)
 
@@ -204,6 +193,8 @@ with st.sidebar.form("pid_form"):
     ki = st.slider("Integral (Ki)", 0.0, 1.0, key='ki', step=0.001)
     kd = st.slider("Derivative (Kd)", 0.0, 1.0, key='kd', step=0.01)
     
+    live_view = st.checkbox("📡 Live telemetry (real-time pace)", value=False,
+                            help="Stream the flight over UDP while it runs at 10 Hz wall-clock.")
     submitted = st.form_submit_button("🚀 Run Mission")
 
 # --- AI AUTO-TUNER SECTION ---
@@ -252,22 +243,14 @@ if not submitted:
 
 # 3. MAIN LOGIC
 if submitted:    
+    if live_view:
+        stream_live_mission(kp, ki, kd, steps, t1_val, t2_val, switch_val)
     try:
-        subprocess.run(
-            [EXE_PATH, str(kp), str(ki), str(kd), str(steps), str(t1_val), str(t2_val), str(switch_val)], 
-            cwd=BUILD_DIR, check=True
-        )
+        df, (rmse, overshoot, settling_time) = run_mission(kp, ki, kd, steps, t1_val, t2_val, switch_val)
     except Exception as e:
         st.error(f"Error: {e}")
         st.stop()
 
-    if not os.path.exists(CSV_PATH):
-        st.error("Telemetry file missing.")
-        st.stop()
-        
-    df = pd.read_csv(CSV_PATH)
-    rmse, overshoot, settling_time = calculate_metrics(df, switch_val, mission_mode)
-
     col1, col2, col3 = st.columns(3)
     col1.metric("Settling Time", f"{settling_time:.2f} s", delta_color="inverse")
     col2.metric("Overshoot", f"{overshoot:.1f} %", delta_color="inverse")
@@ -296,7 +279,7 @@ if submitted:
 
     # SETTLING LINE
     if settling_time != float('inf') and settling_time > 0:
-        start_time = df['Time'].iloc[switch_val] if switch_val < len(df) else 0.0
+        start_time = switch_val * MISSION_DT if switch_val < steps else 0.0
         settled_abs_time = start_time + settling_time
         
         fig.add_vline(
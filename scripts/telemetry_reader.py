@@ -0,0 +1,47 @@
+"""Zero-parse reader for flight_controller's binary telemetry (--format=bin64/bin32).
+
+Layout (little-endian, see include/Telemetry.hpp):
+    64-byte header: magic "AEROTLM\\0", version, value size, column count,
+                    header size, dt, step count
+    16 bytes per column name
+    then each column as `steps` contiguous float32/float64 values
+"""
+import struct
+
+import numpy as np
+import pandas as pd
+
+MAGIC = b"AEROTLM\0"
+HEADER = struct.Struct("<8sIIIIdQ24x")
+COLUMN_NAME_SIZE = 16
+
+
+def read_header(path):
+    with open(path, "rb") as f:
+        raw = f.read(HEADER.size)
+        magic, version, value_size, columns, header_size, dt, steps = HEADER.unpack(raw)
+        if magic != MAGIC:
+            raise ValueError(f"{path} is not an AeroStream telemetry file")
+        names = [f.read(COLUMN_NAME_SIZE).split(b"\0", 1)[0].decode() for _ in range(columns)]
+    return {
+        "version": version,
+        "dtype": np.float32 if value_size == 4 else np.float64,
+        "columns": names,
+        "header_size": header_size,
+        "dt": dt,
+        "steps": steps,
+    }
+
+
+def load_binary_telemetry(path):
+    """Returns (columns, header) where columns maps name -> numpy.memmap (no copy, no parsing)."""
+    header = read_header(path)
+    data = np.memmap(path, dtype=header["dtype"], mode="r", offset=header["header_size"],
+                     shape=(len(header["columns"]), header["steps"]))
+    return {name: data[i] for i, name in enumerate(header["columns"])}, header
+
+
+def load_binary_dataframe(path):
+    """Convenience wrapper for code that expects the telemetry.csv DataFrame."""
+    columns, _ = load_binary_telemetry(path)
+    return pd.DataFrame(columns)
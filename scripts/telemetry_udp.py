@@ -0,0 +1,53 @@
+"""Receiver for flight_controller's live UDP telemetry (--udp=host:port --decimate=N).
+
+Packet layout (little-endian, see include/UdpTelemetry.hpp):
+    16-byte header: magic "ATLP", version, record count, sequence, flags, decimation
+    then `count` records of Time, Target, Actual, Output as float64
+"""
+import socket
+import struct
+
+import numpy as np
+
+MAGIC = b"ATLP"
+HEADER = struct.Struct("<4sHHIHH")
+FLAG_LAST = 1
+RECORD_DTYPE = np.dtype([("Time", "<f8"), ("Target", "<f8"), ("Actual", "<f8"), ("Output", "<f8")])
+
+
+class TelemetryReceiver:
+    """Collects packets from one run. Gaps in the sequence counter are counted in `lost`."""
+
+    def __init__(self, port, host="0.0.0.0", group=None):
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.sock.bind((host, port))
+        if group:  # Multicast, e.g. 239.0.0.1
+            mreq = struct.pack("4s4s", socket.inet_aton(group), socket.inet_aton("0.0.0.0"))
+            self.sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+        self.next_sequence = None
+        self.lost = 0
+        self.finished = False
+
+    def poll(self, timeout=0.1):
+        """Returns the records received within `timeout` seconds as a numpy structured array."""
+        self.sock.settimeout(timeout)
+        chunks = []
+        while not self.finished:
+            try:
+                packet = self.sock.recv(65536)
+            except (socket.timeout, BlockingIOError):
+                break
+            magic, _, count, sequence, flags, _ = HEADER.unpack_from(packet)
+            if magic != MAGIC:
+                continue
+            if self.next_sequence is not None and sequence > self.next_sequence:
+                self.lost += sequence - self.next_sequence
+            self.next_sequence = sequence + 1
+            chunks.append(np.frombuffer(packet, dtype=RECORD_DTYPE, count=count, offset=HEADER.size))
+            self.finished = bool(flags & FLAG_LAST)
+            self.sock.settimeout(0)  # Drain whatever else is queued without waiting
+        return np.concatenate(chunks) if chunks else np.empty(0, dtype=RECORD_DTYPE)
+
+    def close(self):
+        self.sock.close()
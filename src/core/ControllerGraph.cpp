@@ -0,0 +1,214 @@
+#include "ControllerGraph.hpp"
+#include <algorithm> // for std::clamp (C++17)
+#include <stdexcept>
+
+ControllerGraph::ControllerGraph(double dt) : _dt(dt), _compiled(false)
+{
+}
+
+void ControllerGraph::checkBuilding(Signal s) const
+{
+    if (_compiled)
+        throw std::logic_error("ControllerGraph: cannot add stages after compile()");
+    if (s >= _signals.size())
+        throw std::out_of_range("ControllerGraph: unknown signal");
+}
+
+Signal ControllerGraph::newSignal(double initial)
+{
+    _signals.push_back(initial);
+    return static_cast<Signal>(_signals.size() - 1);
+}
+
+Signal ControllerGraph::input(const std::string &name)
+{
+    if (_compiled)
+        throw std::logic_error("ControllerGraph: cannot add inputs after compile()");
+    Signal s = newSignal();
+    _input_names.push_back(name);
+    _inputs.push_back(s);
+    return s;
+}
+
+Signal ControllerGraph::constant(double value)
+{
+    if (_compiled)
+        throw std::logic_error("ControllerGraph: cannot add constants after compile()");
+    return newSignal(value);
+}
+
+Signal ControllerGraph::addNode(OpCode code, Signal a, Signal b, std::initializer_list<double> params, std::size_t state)
+{
+    checkBuilding(a);
+    checkBuilding(b);
+
+    Node node;
+    node.code = code;
+    node.a = a;
+    node.b = b;
+    node.data.fill(0.0);
+    std::copy(params.begin(), params.end(), node.data.begin());
+    node.size = params.size() + state;
+    node.out = newSignal();
+    _nodes.push_back(node);
+    return node.out;
+}
+
+Signal ControllerGraph::pid(Signal setpoint, Signal pv, const PIDStage &stage)
+{
+    checkBuilding(setpoint); // Before the law is kept
+    checkBuilding(pv);
+    _laws.emplace_back(stage.kp, stage.ki, stage.kd, _dt, stage.max_output, stage.min_output, stage.options);
+    return addNode(OpCode::Pid, setpoint, pv, {static_cast<double>(_laws.size() - 1)}, 3);
+}
+
+Signal ControllerGraph::lowPass(Signal in, double time_constant)
+{
+    return addNode(OpCode::LowPass, in, in, {_dt / (time_constant + _dt)}, 2);
+}
+
+Signal ControllerGraph::derivative(Signal in)
+{
+    return addNode(OpCode::Derivative, in, in, {1.0 / _dt}, 2);
+}
+
+Signal ControllerGraph::gain(Signal in, double k)
+{
+    return addNode(OpCode::Gain, in, in, {k}, 0);
+}
+
+Signal ControllerGraph::sum(Signal a, Signal b, double k)
+{
+    return addNode(OpCode::Sum, a, b, {k}, 0);
+}
+
+Signal ControllerGraph::clamp(Signal in, double lo, double hi)
+{
+    return addNode(OpCode::Clamp, in, in, {lo, hi}, 0);
+}
+
+void ControllerGraph::output(const std::string &name, Signal s)
+{
+    checkBuilding(s);
+    _output_names.push_back(name);
+    _outputs.push_back(s);
+}
+
+void ControllerGraph::compile()
+{
+    if (_compiled)
+        throw std::logic_error("ControllerGraph: already compiled");
+    if (_outputs.empty())
+        throw std::logic_error("ControllerGraph: no outputs");
+
+    // 1. Liveness, walking back from the outputs (nodes only read earlier signals)
+    std::vector<char> live(_signals.size(), 0);
+    for (Signal s : _outputs)
+        live[s] = 1;
+    for (std::size_t n = _nodes.size(); n-- > 0;)
+    {
+        const Node &node = _nodes[n];
+        if (live[node.out])
+            live[node.a] = live[node.b] = 1;
+    }
+
+    // 2. Flatten the live nodes in creation order
+    for (const Node &node : _nodes)
+    {
+        if (!live[node.out])
+            continue;
+        _schedule.push_back({node.code, node.a, node.b, node.out, static_cast<std::uint32_t>(_data.size())});
+        _data.insert(_data.end(), node.data.begin(), node.data.begin() + node.size);
+    }
+
+    _initial = _data;
+    _constants = _signals;
+    _nodes.clear();
+    _nodes.shrink_to_fit();
+    _compiled = true;
+}
+
+void ControllerGraph::step()
+{
+    double *signals = _signals.data();
+    double *data = _data.data();
+
+    for (const Op &op : _schedule)
+    {
+        double *d = data + op.data;
+        const double x = signals[op.a];
+        double y;
+        switch (op.code)
+        {
+        case OpCode::Pid: // d = law index, integral, pre_error, derivative
+            y = _laws[static_cast<std::size_t>(d[0])].calculate(x, signals[op.b], d[1], d[2], d[3]);
+            break;
+        case OpCode::LowPass: // d = alpha, y, primed
+            y = (d[2] != 0.0) ? d[1] + d[0] * (x - d[1]) : x;
+            d[1] = y;
+            d[2] = 1.0;
+            break;
+        case OpCode::Derivative: // d = 1/dt, previous, primed
+            y = (d[2] != 0.0) ? (x - d[1]) * d[0] : 0.0;
+            d[1] = x;
+            d[2] = 1.0;
+            break;
+        case OpCode::Gain:
+            y = d[0] * x;
+            break;
+        case OpCode::Sum:
+            y = x + d[0] * signals[op.b];
+            break;
+        case OpCode::Clamp:
+        default:
+            y = std::clamp(x, d[0], d[1]);
+            break;
+        }
+        signals[op.out] = y;
+    }
+}
+
+void ControllerGraph::reset()
+{
+    std::copy(_initial.begin(), _initial.end(), _data.begin());
+    std::copy(_constants.begin(), _constants.end(), _signals.begin());
+}
+
+double ControllerGraph::calculate(double setpoint, double pv)
+{
+    if (!_compiled || _inputs.size() < 2)
+        throw std::logic_error("ControllerGraph: calculate() needs a compiled graph with setpoint and measurement inputs");
+    _signals[_inputs[0]] = setpoint;
+    _signals[_inputs[1]] = pv;
+    step();
+    return _signals[_outputs[0]];
+}
+
+Signal ControllerGraph::inputSignal(const std::string &name) const
+{
+    for (std::size_t i = 0; i < _input_names.size(); i++)
+        if (_input_names[i] == name)
+            return _inputs[i];
+    throw std::out_of_range("ControllerGraph: no input '" + name + "'");
+}
+
+Signal ControllerGraph::outputSignal(const std::string &name) const
+{
+    for (std::size_t i = 0; i < _output_names.size(); i++)
+        if (_output_names[i] == name)
+            return _outputs[i];
+    throw std::out_of_range("ControllerGraph: no output '" + name + "'");
+}
+
+ControllerGraph makeAltitudeCascade(const PIDStage &altitude, const PIDStage &velocity, double velocity_filter, double dt)
+{
+    ControllerGraph graph(dt);
+    Signal setpoint = graph.input("altitude_sp");
+    Signal measured = graph.input("altitude");
+
+    Signal climb_rate_sp = graph.pid(setpoint, measured, altitude);
+    Signal climb_rate = graph.lowPass(graph.derivative(measured), velocity_filter);
+    graph.output("command", graph.pid(climb_rate_sp, climb_rate, velocity));
+    graph.compile();
+    return graph;
+}
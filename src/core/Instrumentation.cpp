@@ -0,0 +1,47 @@
+#include "Instrumentation.hpp"
+#include <thread>
+
+#if defined(AEROSTREAM_INSTRUMENT_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+double instrumentation::tscNanosPerTick()
+{
+    static const double ns_per_tick = []() {
+        auto t0 = std::chrono::steady_clock::now();
+        std::uint64_t c0 = __rdtsc();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::uint64_t c1 = __rdtsc();
+        auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(c1 - c0);
+    }();
+    return ns_per_tick;
+}
+#endif
+
+void LoopProfiler::writeJson(std::ostream &out) const
+{
+    static const char *names[] = {"sensor_read", "controller", "physics", "telemetry", "tick"};
+
+#ifdef AEROSTREAM_ENABLE_INSTRUMENTATION
+    const bool enabled = true;
+#else
+    const bool enabled = false;
+#endif
+
+    out << "{\n";
+    out << "  \"build\": {\"instrumentation\": " << (enabled ? "true" : "false")
+        << ", \"clock\": \"" << instrumentation::clockName() << "\""
+#ifdef __VERSION__
+        << ", \"compiler\": \"" << __VERSION__ << "\""
+#endif
+        << "},\n";
+    out << "  \"stages\": {\n";
+    for (int s = 0; s < static_cast<int>(LoopStage::Count); s++)
+    {
+        const LatencyHistogram &h = _stages[s];
+        out << "    \"" << names[s] << "\": {\"count\": " << h.count() << ", \"mean_ns\": " << h.mean()
+            << ", \"p50_ns\": " << h.percentile(0.5) << ", \"p99_ns\": " << h.percentile(0.99)
+            << ", \"p999_ns\": " << h.percentile(0.999) << ", \"max_ns\": " << h.max() << "}"
+            << (s + 1 < static_cast<int>(LoopStage::Count) ? "," : "") << "\n";
+    }
+    out << "  }\n";
+    out << "}\n";
+}
@@ -0,0 +1,112 @@
+#include "LatencyHistogram.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Index of the most significant set bit (ns > 0)
+    int highestBit(std::uint64_t ns)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - __builtin_clzll(ns);
+#else
+        int bit = 0;
+        while (ns >>= 1)
+            bit++;
+        return bit;
+#endif
+    }
+}
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+int LatencyHistogram::bucketOf(std::uint64_t ns)
+{
+    // Values below kSubBuckets get one exact bucket each (magnitude 0)
+    if (ns < static_cast<std::uint64_t>(kSubBuckets))
+        return static_cast<int>(ns);
+
+    int msb = highestBit(ns);
+    int magnitude = msb - kSubBucketBits + 1;
+    if (magnitude >= kMagnitudes)
+        return kBuckets - 1; // Saturate instead of dropping the sample
+
+    int sub = static_cast<int>(ns >> (magnitude - 1)) - kSubBuckets; // Top bits below the MSB
+    return magnitude * kSubBuckets + sub;
+}
+
+std::uint64_t LatencyHistogram::lowerEdge(int bucket)
+{
+    int magnitude = bucket / kSubBuckets;
+    std::uint64_t sub = bucket % kSubBuckets;
+    if (magnitude == 0)
+        return sub;
+    return (static_cast<std::uint64_t>(kSubBuckets) + sub) << (magnitude - 1);
+}
+
+std::uint64_t LatencyHistogram::upperEdge(int bucket)
+{
+    int magnitude = bucket / kSubBuckets;
+    if (magnitude == 0)
+        return lowerEdge(bucket);
+    return lowerEdge(bucket) + (std::uint64_t(1) << (magnitude - 1)) - 1;
+}
+
+void LatencyHistogram::record(std::uint64_t ns)
+{
+    _buckets[bucketOf(ns)]++;
+    _count++;
+    _sum += ns;
+    _min = std::min(_min, ns);
+    _max = std::max(_max, ns);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other)
+{
+    for (int b = 0; b < kBuckets; b++)
+        _buckets[b] += other._buckets[b];
+    _count += other._count;
+    _sum += other._sum;
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+}
+
+void LatencyHistogram::reset()
+{
+    _buckets.fill(0);
+    _count = 0;
+    _sum = 0;
+    _min = UINT64_MAX;
+    _max = 0;
+}
+
+std::uint64_t LatencyHistogram::percentile(double q) const
+{
+    if (_count == 0)
+        return 0;
+
+    q = std::min(std::max(q, 0.0), 1.0);
+    std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(q * _count)));
+
+    std::uint64_t seen = 0;
+    for (int b = 0; b < kBuckets; b++)
+    {
+        seen += _buckets[b];
+        if (seen >= rank)
+            return std::min(upperEdge(b), _max);
+    }
+    return _max;
+}
+
+void LatencyHistogram::writeCsv(std::ostream &out) const
+{
+    out << "LowerNs,UpperNs,Count\n";
+    for (int b = 0; b < kBuckets; b++)
+    {
+        if (_buckets[b])
+            out << lowerEdge(b) << "," << upperEdge(b) << "," << _buckets[b] << "\n";
+    }
+}
@@ -0,0 +1,85 @@
+#include "Metrics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+Metrics::Metrics(int segment_start, double target, double start_value, double dt, double tolerance)
+    : _segment_start(segment_start), _target(target), _start_value(start_value), _dt(dt),
+      _upper_bound(target * (1 + tolerance)), _lower_bound(target * (1 - tolerance)), _expected_samples(0)
+{
+    reset();
+}
+
+Metrics::Metrics(const MissionProfile &mission, double tolerance)
+    : Metrics((mission.switch_step > 0 && mission.switch_step < mission.steps) ? mission.switch_step : 0,
+              mission.targetAt(mission.steps - 1),
+              (mission.switch_step > 0 && mission.switch_step < mission.steps) ? mission.target1 : mission.initial_altitude,
+              mission.dt, tolerance)
+{
+    _expected_samples = mission.steps - _segment_start;
+}
+
+void Metrics::update(int step, double target, double actual)
+{
+    if (step < _segment_start)
+        return;
+
+    // 1. RMSE accumulator
+    double error = target - actual;
+    _sum_sq_error += error * error;
+
+    // 2. Peaks for overshoot
+    _max_actual = std::max(_max_actual, actual);
+    _min_actual = std::min(_min_actual, actual);
+
+    // 3. Settling band
+    if (actual > _upper_bound || actual < _lower_bound)
+        _last_out_of_band = step;
+
+    _last_step = step;
+    _samples++;
+}
+
+MetricsSummary Metrics::summary() const
+{
+    MetricsSummary result{0.0, 0.0, 0.0, _samples};
+    if (_samples == 0)
+        return result;
+
+    result.rmse = std::sqrt(_sum_sq_error / _samples);
+
+    double overshoot = (_target > _start_value) ? std::max(0.0, _max_actual - _target)
+                                                : std::max(0.0, _target - _min_actual);
+    result.overshoot_percent = (_target != 0) ? (overshoot / _target) * 100 : 0;
+
+    if (_last_out_of_band < 0)
+        result.settling_time = 0.0;
+    else if (_last_out_of_band == _last_step)
+        result.settling_time = std::numeric_limits<double>::infinity();
+    else
+        result.settling_time = _last_out_of_band * _dt - _segment_start * _dt;
+
+    return result;
+}
+
+double Metrics::rmseLowerBound() const
+{
+    int samples = std::max(_expected_samples, _samples);
+    return (samples > 0) ? std::sqrt(_sum_sq_error / samples) : 0.0;
+}
+
+void Metrics::reset()
+{
+    _sum_sq_error = 0;
+    _max_actual = -std::numeric_limits<double>::infinity();
+    _min_actual = std::numeric_limits<double>::infinity();
+    _samples = 0;
+    _last_step = -1;
+    _last_out_of_band = -1;
+}
+
+void writeSummaryCsv(std::ostream &out, const MetricsSummary &summary)
+{
+    out << "RMSE,Overshoot,SettlingTime,Samples\n";
+    out << summary.rmse << "," << summary.overshoot_percent << "," << summary.settling_time << "," << summary.samples << "\n";
+}
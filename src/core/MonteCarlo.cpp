@@ -0,0 +1,123 @@
+#include "MonteCarlo.hpp"
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include "Noise.hpp"
+#include "Simulation.hpp"
+#include "ThreadPool.hpp"
+
+namespace
+{
+    // Uniform factor in [1 - spread, 1 + spread)
+    double perturb(Xoshiro256 &rng, double spread)
+    {
+        return 1.0 + spread * (2.0 * rng.nextDouble() - 1.0);
+    }
+}
+
+MissionProfile monteCarloSample(const MissionProfile &mission, const MonteCarloConfig &config, int sample,
+                                std::size_t candidate)
+{
+    // 1. One stream per sample (shared) or per candidate x sample (independent)
+    std::uint64_t stream = static_cast<std::uint64_t>(sample);
+    if (!config.common_random_numbers)
+        stream += static_cast<std::uint64_t>(candidate) * static_cast<std::uint64_t>(std::max(config.samples, 0));
+    Xoshiro256 rng(config.seed ^ (stream * 0x9e3779b97f4a7c15ULL));
+
+    // 2. Draw the sample (always the same number of draws, so streams line up)
+    const PlantPerturbation &p = config.perturbation;
+    MissionProfile out = mission;
+    out.noise.seed = rng.next();
+    out.noise.amplitude *= perturb(rng, p.noise);
+    out.plant.vehicle.mass *= perturb(rng, p.mass);
+    out.plant.vehicle.thrust_gain *= perturb(rng, p.thrust_gain);
+    out.plant.vehicle.drag *= perturb(rng, p.drag);
+    out.plant.vehicle.motor_tau *= perturb(rng, p.motor_tau);
+    return out;
+}
+
+SampleStats sampleStats(const std::vector<double> &values)
+{
+    // Two passes: exact enough for K in the thousands, and no cancellation
+    const double n = static_cast<double>(values.size());
+    double sum = 0.0, worst = -std::numeric_limits<double>::infinity();
+    for (double v : values)
+    {
+        sum += v;
+        worst = std::max(worst, v);
+    }
+    const double mean = sum / n;
+
+    double sq = 0.0;
+    for (double v : values)
+        sq += (v - mean) * (v - mean);
+    return {mean, (values.size() > 1) ? sq / (n - 1.0) : 0.0, worst};
+}
+
+std::vector<MonteCarloResult> runMonteCarlo(const std::vector<PIDGains> &candidates, const MissionProfile &mission,
+                                            const MonteCarloConfig &config)
+{
+    const PlantPerturbation &p = config.perturbation;
+    for (double spread : {p.mass, p.thrust_gain, p.drag, p.motor_tau, p.noise})
+        if (!(spread >= 0.0 && spread < 1.0))
+            throw std::invalid_argument("Monte Carlo perturbation spreads must be in [0, 1)");
+
+    const std::size_t n = candidates.size();
+    const std::size_t k = static_cast<std::size_t>(std::max(config.samples, 0));
+    std::vector<MonteCarloResult> results(n);
+    for (std::size_t c = 0; c < n; c++)
+        results[c].gains = candidates[c]; // Named even when there are no samples to fill in
+    if (n == 0 || k == 0)
+        return results;
+
+    // 1. Simulate: runs[c * k + s], samples spread over the pool
+    std::vector<MetricsSummary> runs(n * k);
+    ThreadPool pool(config.threads);
+    pool.parallelFor(k, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t s = begin; s < end; s++)
+        {
+            if (config.common_random_numbers)
+            {
+                std::vector<MetricsSummary> batch =
+                    simulateBatch(candidates, monteCarloSample(mission, config, static_cast<int>(s), 0));
+                for (std::size_t c = 0; c < n; c++)
+                    runs[c * k + s] = batch[c];
+                continue;
+            }
+            for (std::size_t c = 0; c < n; c++)
+                runs[c * k + s] = simulateMetrics(candidates[c], monteCarloSample(mission, config, static_cast<int>(s), c));
+        }
+    });
+
+    // 2. Reduce per candidate
+    std::vector<double> rmse(k), overshoot(k), settled, delta(k);
+    for (std::size_t c = 0; c < n; c++)
+    {
+        MonteCarloResult &r = results[c];
+        r.unsettled = 0;
+        settled.clear();
+        for (std::size_t s = 0; s < k; s++)
+        {
+            const MetricsSummary &m = runs[c * k + s];
+            rmse[s] = m.rmse;
+            overshoot[s] = m.overshoot_percent;
+            delta[s] = m.rmse - runs[s].rmse;
+            if (std::isfinite(m.settling_time))
+                settled.push_back(m.settling_time);
+            else
+                r.unsettled++;
+        }
+
+        r.rmse = sampleStats(rmse);
+        r.overshoot_percent = sampleStats(overshoot);
+        r.rmse_delta = sampleStats(delta);
+
+        const double inf = std::numeric_limits<double>::infinity();
+        r.settling_time = settled.empty() ? SampleStats{inf, 0.0, inf} : sampleStats(settled);
+        if (r.unsettled > 0)
+            r.settling_time.worst = inf;
+    }
+    return results;
+}
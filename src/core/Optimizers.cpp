@@ -0,0 +1,462 @@
+#include "Optimizers.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include "Noise.hpp"
+
+namespace
+{
+    const double kInf = std::numeric_limits<double>::infinity();
+    const double kTwoPi = 6.283185307179586;
+    const int kDim = 3;
+
+    using Point = std::array<double, 3>;
+
+    // Gains must stay non-negative; candidates are projected before they fly
+    Point project(Point x)
+    {
+        for (double &v : x)
+            v = std::max(v, 0.0);
+        return x;
+    }
+
+    PIDGains toGains(const Point &x) { return {x[0], x[1], x[2]}; }
+
+    std::vector<double> evaluatePoints(PopulationEvaluator &evaluator, const std::vector<Point> &points,
+                                       const std::vector<double> &bounds)
+    {
+        std::vector<PIDGains> candidates;
+        candidates.reserve(points.size());
+        for (const Point &p : points)
+            candidates.push_back(toGains(p));
+        return evaluator.evaluate(candidates, bounds);
+    }
+
+    // Standard normal sample (Box-Muller)
+    double gaussian(Xoshiro256 &rng)
+    {
+        double u1 = 1.0 - rng.nextDouble(); // (0, 1]
+        double u2 = rng.nextDouble();
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(kTwoPi * u2);
+    }
+
+    // --- Nelder-Mead ---
+
+    void runNelderMead(PopulationEvaluator &evaluator, const OptimizerConfig &config)
+    {
+        // 1. Initial simplex: the start point plus one step along each gain
+        std::vector<Point> simplex(kDim + 1, project(config.initial));
+        for (int d = 0; d < kDim; d++)
+            simplex[d + 1][d] += config.scale[d];
+        std::vector<double> cost = evaluatePoints(evaluator, simplex, std::vector<double>(kDim + 1, kInf));
+
+        while (evaluator.evaluations() < config.max_evaluations)
+        {
+            // 2. Order the vertices, best first
+            std::vector<int> order(kDim + 1);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return cost[a] < cost[b]; });
+            std::vector<Point> sorted_simplex;
+            std::vector<double> sorted_cost;
+            for (int i : order)
+            {
+                sorted_simplex.push_back(simplex[i]);
+                sorted_cost.push_back(cost[i]);
+            }
+            simplex.swap(sorted_simplex);
+            cost.swap(sorted_cost);
+
+            double spread = 0.0;
+            for (int i = 1; i <= kDim; i++)
+                for (int d = 0; d < kDim; d++)
+                    spread = std::max(spread, std::fabs(simplex[i][d] - simplex[0][d]));
+            if (spread < 1e-6)
+                break;
+
+            Point centroid = {0.0, 0.0, 0.0};
+            for (int i = 0; i < kDim; i++)
+                for (int d = 0; d < kDim; d++)
+                    centroid[d] += simplex[i][d] / kDim;
+
+            // 3. Reflection, expansion, outside and inside contraction in one batch.
+            //    None of them is accepted unless it beats the worst vertex.
+            auto along = [&](double t) {
+                Point x;
+                for (int d = 0; d < kDim; d++)
+                    x[d] = centroid[d] + t * (centroid[d] - simplex[kDim][d]);
+                return project(x);
+            };
+            std::vector<Point> trial = {along(1.0), along(2.0), along(0.5), along(-0.5)};
+            std::vector<double> f = evaluatePoints(evaluator, trial, std::vector<double>(4, cost[kDim]));
+            const double fr = f[0], fe = f[1], foc = f[2], fic = f[3];
+
+            int accept = -1;
+            if (fr < cost[0])
+                accept = (fe < fr) ? 1 : 0;
+            else if (fr < cost[kDim - 1])
+                accept = 0;
+            else if (fr < cost[kDim])
+                accept = (foc <= fr) ? 2 : -1;
+            else
+                accept = (fic < cost[kDim]) ? 3 : -1;
+
+            if (accept >= 0)
+            {
+                simplex[kDim] = trial[accept];
+                cost[kDim] = f[accept];
+                continue;
+            }
+
+            // 4. Shrink towards the best vertex
+            std::vector<Point> shrunk;
+            for (int i = 1; i <= kDim; i++)
+            {
+                Point x;
+                for (int d = 0; d < kDim; d++)
+                    x[d] = simplex[0][d] + 0.5 * (simplex[i][d] - simplex[0][d]);
+                shrunk.push_back(project(x));
+            }
+            std::vector<double> fs = evaluatePoints(evaluator, shrunk, std::vector<double>(kDim, kInf));
+            for (int i = 1; i <= kDim; i++)
+            {
+                simplex[i] = shrunk[i - 1];
+                cost[i] = fs[i - 1];
+            }
+        }
+    }
+
+    // --- Differential evolution ---
+
+    void runDifferentialEvolution(PopulationEvaluator &evaluator, const OptimizerConfig &config)
+    {
+        const double F = 0.7, CR = 0.9;
+        const int np = std::max(config.population > 0 ? config.population : 16, 4);
+        Xoshiro256 rng(config.seed);
+        auto pick = [&](int n) { return static_cast<int>(rng.next() % static_cast<std::uint64_t>(n)); };
+
+        // 1. Population scattered around the start point (which is member 0)
+        std::vector<Point> population(np, project(config.initial));
+        for (int i = 1; i < np; i++)
+            for (int d = 0; d < kDim; d++)
+                population[i][d] += config.scale[d] * (2.0 * rng.nextDouble() - 1.0);
+        for (Point &p : population)
+            p = project(p);
+        std::vector<double> cost = evaluatePoints(evaluator, population, std::vector<double>(np, kInf));
+
+        while (evaluator.evaluations() < config.max_evaluations)
+        {
+            // 2. One rand/1/bin trial per member
+            std::vector<Point> trial(np);
+            for (int i = 0; i < np; i++)
+            {
+                int r1, r2, r3;
+                do r1 = pick(np); while (r1 == i);
+                do r2 = pick(np); while (r2 == i || r2 == r1);
+                do r3 = pick(np); while (r3 == i || r3 == r1 || r3 == r2);
+
+                int forced = pick(kDim);
+                for (int d = 0; d < kDim; d++)
+                {
+                    bool cross = (d == forced) || rng.nextDouble() < CR;
+                    trial[i][d] = cross ? population[r1][d] + F * (population[r2][d] - population[r3][d]) : population[i][d];
+                }
+                trial[i] = project(trial[i]);
+            }
+
+            // 3. Each trial only has to beat its own parent
+            std::vector<double> f = evaluatePoints(evaluator, trial, cost);
+            for (int i = 0; i < np; i++)
+            {
+                if (f[i] <= cost[i])
+                {
+                    population[i] = trial[i];
+                    cost[i] = f[i];
+                }
+            }
+        }
+    }
+
+    // --- CMA-ES ---
+
+    void runCmaEs(PopulationEvaluator &evaluator, const OptimizerConfig &config)
+    {
+        const int n = kDim;
+        const int lambda = std::max(config.population > 0 ? config.population : 8, 4);
+        const int mu = lambda / 2;
+        Xoshiro256 rng(config.seed);
+
+        // 1. Strategy parameters (Hansen's defaults)
+        std::vector<double> w(mu);
+        for (int i = 0; i < mu; i++)
+            w[i] = std::log(mu + 0.5) - std::log(i + 1.0);
+        double wsum = std::accumulate(w.begin(), w.end(), 0.0);
+        double w2sum = 0.0;
+        for (double &wi : w)
+        {
+            wi /= wsum;
+            w2sum += wi * wi;
+        }
+        const double mueff = 1.0 / w2sum;
+        const double cc = (4.0 + mueff / n) / (n + 4.0 + 2.0 * mueff / n);
+        const double cs = (mueff + 2.0) / (n + mueff + 5.0);
+        const double c1 = 2.0 / ((n + 1.3) * (n + 1.3) + mueff);
+        const double cmu = std::min(1.0 - c1, 2.0 * (mueff - 2.0 + 1.0 / mueff) / ((n + 2.0) * (n + 2.0) + mueff));
+        const double damps = 1.0 + 2.0 * std::max(0.0, std::sqrt((mueff - 1.0) / (n + 1.0)) - 1.0) + cs;
+        const double chi_n = std::sqrt(static_cast<double>(n)) * (1.0 - 1.0 / (4.0 * n) + 1.0 / (21.0 * n * n));
+
+        // 2. State, in coordinates normalized by config.scale
+        Point mean;
+        for (int d = 0; d < n; d++)
+            mean[d] = project(config.initial)[d] / config.scale[d];
+        double sigma = 0.5;
+        double C[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+        Point pc = {0, 0, 0}, ps = {0, 0, 0};
+
+        for (int generation = 0; evaluator.evaluations() < config.max_evaluations; generation++)
+        {
+            // 3. C = B diag(D^2) B^T
+            double eigenvalues[3], B[3][3];
+            jacobiEigen3(C, eigenvalues, B);
+            double D[3];
+            for (int d = 0; d < n; d++)
+                D[d] = std::sqrt(std::max(eigenvalues[d], 1e-20));
+            if (sigma * *std::max_element(D, D + n) < 1e-8)
+                break;
+
+            // 4. Sample and evaluate the generation
+            std::vector<Point> y(lambda), x(lambda);
+            for (int k = 0; k < lambda; k++)
+            {
+                double z[3], bdz[3] = {0, 0, 0};
+                for (int d = 0; d < n; d++)
+                    z[d] = D[d] * gaussian(rng);
+                for (int r = 0; r < n; r++)
+                    for (int c = 0; c < n; c++)
+                        bdz[r] += B[r][c] * z[c];
+                for (int d = 0; d < n; d++)
+                {
+                    y[k][d] = mean[d] + sigma * bdz[d];
+                    x[k][d] = y[k][d] * config.scale[d];
+                }
+                x[k] = project(x[k]);
+            }
+            // No cost bound: every one of the mu best is weighted into the update,
+            // so a run stopped early (cost infinity) would steer it arbitrarily.
+            // Only diverged runs cost infinity, and those rank last.
+            std::vector<double> f = evaluatePoints(evaluator, x, std::vector<double>(lambda, kInf));
+
+            std::vector<int> order(lambda);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return f[a] < f[b]; });
+
+            // 5. Recombine the mu best into the new mean
+            Point old_mean = mean;
+            mean = {0, 0, 0};
+            for (int i = 0; i < mu; i++)
+                for (int d = 0; d < n; d++)
+                    mean[d] += w[i] * y[order[i]][d];
+
+            Point step;
+            for (int d = 0; d < n; d++)
+                step[d] = (mean[d] - old_mean[d]) / sigma;
+
+            // 6. Evolution paths: ps uses C^(-1/2) = B D^-1 B^T
+            double bt_step[3] = {0, 0, 0};
+            for (int c = 0; c < n; c++)
+                for (int r = 0; r < n; r++)
+                    bt_step[c] += B[r][c] * step[r];
+            double ps_norm = 0.0;
+            for (int r = 0; r < n; r++)
+            {
+                double inv_sqrt = 0.0;
+                for (int c = 0; c < n; c++)
+                    inv_sqrt += B[r][c] * bt_step[c] / D[c];
+                ps[r] = (1.0 - cs) * ps[r] + std::sqrt(cs * (2.0 - cs) * mueff) * inv_sqrt;
+                ps_norm += ps[r] * ps[r];
+            }
+            ps_norm = std::sqrt(ps_norm);
+
+            const double hsig = (ps_norm / std::sqrt(1.0 - std::pow(1.0 - cs, 2.0 * (generation + 1))) / chi_n
+                                 < 1.4 + 2.0 / (n + 1.0)) ? 1.0 : 0.0;
+            for (int d = 0; d < n; d++)
+                pc[d] = (1.0 - cc) * pc[d] + hsig * std::sqrt(cc * (2.0 - cc) * mueff) * step[d];
+
+            // 7. Covariance: rank-one plus rank-mu update
+            for (int r = 0; r < n; r++)
+            {
+                for (int c = 0; c < n; c++)
+                {
+                    double rank_mu = 0.0;
+                    for (int i = 0; i < mu; i++)
+                    {
+                        const Point &yi = y[order[i]];
+                        rank_mu += w[i] * (yi[r] - old_mean[r]) * (yi[c] - old_mean[c]) / (sigma * sigma);
+                    }
+                    C[r][c] = (1.0 - c1 - cmu) * C[r][c]
+                              + c1 * (pc[r] * pc[c] + (1.0 - hsig) * cc * (2.0 - cc) * C[r][c])
+                              + cmu * rank_mu;
+                }
+            }
+
+            // 8. Step size
+            sigma *= std::exp((cs / damps) * (ps_norm / chi_n - 1.0));
+        }
+    }
+}
+
+bool parseOptimizerMethod(const std::string &name, OptimizerMethod &method)
+{
+    if (name == "twiddle")
+        method = OptimizerMethod::Twiddle;
+    else if (name == "nelder-mead" || name == "nm")
+        method = OptimizerMethod::NelderMead;
+    else if (name == "de")
+        method = OptimizerMethod::DifferentialEvolution;
+    else if (name == "cmaes" || name == "cma-es")
+        method = OptimizerMethod::CmaEs;
+    else
+        return false;
+    return true;
+}
+
+// --- PopulationEvaluator ---
+
+PopulationEvaluator::PopulationEvaluator(const MissionProfile &mission, TuningStrategy strategy, unsigned threads,
+                                         const RunLimits &limits)
+    : _mission(mission), _strategy(strategy), _limits(limits), _pool(threads > 1 ? std::make_unique<ThreadPool>(threads) : nullptr),
+      _best{0.0, 0.0, 0.0}, _best_cost(kInf), _evaluations(0), _aborted(0)
+{
+}
+
+std::vector<double> PopulationEvaluator::evaluate(const std::vector<PIDGains> &candidates, const std::vector<double> &bounds)
+{
+    const std::size_t n = candidates.size();
+    std::vector<double> costs(n, kInf);
+    if (n == 0 || _mission.steps <= 0)
+        return costs;
+
+    // 1. Fly the generation: one PIDBatch per shard (lanes are independent, so
+    //    the split does not change any result)
+    std::vector<RunResult> runs(n);
+    auto shard = [&](std::size_t begin, std::size_t end) {
+        std::vector<PIDGains> lanes(candidates.begin() + begin, candidates.begin() + end);
+        std::vector<double> lane_bounds(bounds.begin() + begin, bounds.begin() + end);
+        std::vector<RunResult> part = simulateBatchBounded(lanes, _mission, lane_bounds, _limits);
+        std::copy(part.begin(), part.end(), runs.begin() + begin);
+    };
+    if (_pool)
+        _pool->parallelFor(n, (n + _pool->size() - 1) / _pool->size(), shard);
+    else
+        shard(0, n);
+
+    // 2. Cost and bookkeeping
+    for (std::size_t c = 0; c < n; c++)
+    {
+        _evaluations++;
+        if (runs[c].status != RunStatus::Completed)
+        {
+            _aborted++;
+            continue;
+        }
+        costs[c] = missionCost(runs[c].metrics, _strategy);
+        if (costs[c] < _best_cost)
+        {
+            _best_cost = costs[c];
+            _best = candidates[c];
+        }
+    }
+    return costs;
+}
+
+// --- Eigen-decomposition ---
+
+void jacobiEigen3(const double a[3][3], double values[3], double vectors[3][3])
+{
+    double m[3][3];
+    for (int r = 0; r < 3; r++)
+        for (int c = 0; c < 3; c++)
+        {
+            m[r][c] = a[r][c];
+            vectors[r][c] = (r == c) ? 1.0 : 0.0;
+        }
+
+    for (int sweep = 0; sweep < 50; sweep++)
+    {
+        double off = m[0][1] * m[0][1] + m[0][2] * m[0][2] + m[1][2] * m[1][2];
+        if (off < 1e-30)
+            break;
+
+        for (int p = 0; p < 2; p++)
+        {
+            for (int q = p + 1; q < 3; q++)
+            {
+                if (m[p][q] == 0.0)
+                    continue;
+
+                // Rotation that zeroes m[p][q]
+                double theta = (m[q][q] - m[p][p]) / (2.0 * m[p][q]);
+                double t = ((theta >= 0) ? 1.0 : -1.0) / (std::fabs(theta) + std::sqrt(theta * theta + 1.0));
+                double cs = 1.0 / std::sqrt(t * t + 1.0);
+                double sn = t * cs;
+
+                for (int k = 0; k < 3; k++)
+                {
+                    double mkp = m[k][p], mkq = m[k][q];
+                    m[k][p] = cs * mkp - sn * mkq;
+                    m[k][q] = sn * mkp + cs * mkq;
+                }
+                for (int k = 0; k < 3; k++)
+                {
+                    double mpk = m[p][k], mqk = m[q][k];
+                    m[p][k] = cs * mpk - sn * mqk;
+                    m[q][k] = sn * mpk + cs * mqk;
+                }
+                for (int k = 0; k < 3; k++)
+                {
+                    double vkp = vectors[k][p], vkq = vectors[k][q];
+                    vectors[k][p] = cs * vkp - sn * vkq;
+                    vectors[k][q] = sn * vkp + cs * vkq;
+                }
+            }
+        }
+    }
+
+    for (int d = 0; d < 3; d++)
+        values[d] = m[d][d];
+}
+
+// --- Entry point ---
+
+TuningResult optimizeGains(const MissionProfile &mission, const OptimizerConfig &config)
+{
+    if (config.method == OptimizerMethod::Twiddle)
+    {
+        TunerConfig tuner_config;
+        tuner_config.strategy = config.strategy;
+        tuner_config.initial = config.initial;
+        tuner_config.limits = config.limits;
+        tuner_config.cache = config.cache;
+        return Tuner(mission, tuner_config).run();
+    }
+
+    PopulationEvaluator evaluator(mission, config.strategy, config.threads, config.limits);
+    switch (config.method)
+    {
+    case OptimizerMethod::NelderMead:
+        runNelderMead(evaluator, config);
+        break;
+    case OptimizerMethod::DifferentialEvolution:
+        runDifferentialEvolution(evaluator, config);
+        break;
+    case OptimizerMethod::CmaEs:
+        runCmaEs(evaluator, config);
+        break;
+    case OptimizerMethod::Twiddle:
+        break;
+    }
+
+    TuningResult result{evaluator.best(), evaluator.bestCost(), evaluator.evaluations()};
+    result.aborted = evaluator.aborted();
+    return result;
+}
@@ -1,42 +1,43 @@
 #include "PID.hpp"
-#include <algorithm> // for std::clamp (C++17)
 
-PID::PID(double kp, double ki, double kd, double dt, double max_output, double min_output)
-    : _kp(kp), _ki(ki), _kd(kd), _dt(dt), _max_output(max_output), _min_output(min_output), _pre_error(0), _integral(0) 
+double backCalculationGain(double kp, double ki, const PIDOptions &options)
 {
+    if (ki == 0.0)
+        return 0.0; // No integrator to unwind
+    double kt = options.back_calculation_gain;
+    if (kt <= 0.0)
+        kt = (kp != 0.0) ? ki / kp : 1.0;
+    return kt / ki;
 }
 
-double PID::calculate(double setpoint, double pv) {
-    
-    // 1. Calculate Error
-    double error = setpoint - pv;
-
-    // 2. Proportional Term
-    double P = _kp * error;
-
-    // 3. Integral Term (Accumulate error over time)
-    _integral += error * _dt;
-    double I = _ki * _integral;
-
-    // 4. Derivative Term (Rate of change of error)
-    double derivative = (error - _pre_error) / _dt;
-    double D = _kd * derivative;
-
-    // 5. Calculate Total Output
-    double output = P + I + D;
+PIDLaw::PIDLaw(double kp, double ki, double kd, double dt, double max_output, double min_output,
+               const PIDOptions &options)
+    : kp(kp), ki(ki), kd(kd), dt(dt), max_output(max_output), min_output(min_output),
+      filter(options.derivative_filter > 0.0), alpha(dt / (options.derivative_filter + dt)),
+      on_measurement(options.derivative_on_measurement), conditional(options.anti_windup == AntiWindup::Conditional),
+      back_calculation(options.anti_windup == AntiWindup::BackCalculation),
+      back_gain(backCalculationGain(kp, ki, options))
+{
+}
 
-    // 6. Clamp output to hardware limits (Safety!)
-    output = std::clamp(output, _min_output, _max_output);
+PID::PID(double kp, double ki, double kd, double dt, double max_output, double min_output)
+    : PID(kp, ki, kd, dt, max_output, min_output, PIDOptions())
+{
+}
 
-    // 7. Save error for next loop
-    _pre_error = error;
+PID::PID(double kp, double ki, double kd, double dt, double max_output, double min_output, const PIDOptions &options)
+    : _law(kp, ki, kd, dt, max_output, min_output, options), _pre_error(0), _integral(0), _derivative(0)
+{
+}
 
-    return output;
+double PID::calculate(double setpoint, double pv) {
+    return _law.calculate(setpoint, pv, _integral, _pre_error, _derivative);
 }
 
 void PID::reset() {
     _integral = 0;
     _pre_error = 0;
+    _derivative = 0;
 }
 
 PID::~PID() {}
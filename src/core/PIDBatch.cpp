@@ -0,0 +1,171 @@
+#include "PIDBatch.hpp"
+#include <algorithm> // for std::clamp (C++17)
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+PIDBatch::PIDBatch(std::size_t lanes, double dt, double max_output, double min_output)
+    : PIDBatch(lanes, dt, max_output, min_output, PIDOptions())
+{
+}
+
+PIDBatch::PIDBatch(std::size_t lanes, double dt, double max_output, double min_output, const PIDOptions &options)
+    : _kp(lanes, 0.0), _ki(lanes, 0.0), _kd(lanes, 0.0), _integral(lanes, 0.0), _pre_error(lanes, 0.0),
+      _derivative(lanes, 0.0), _back_gain(lanes, 0.0), _dt(dt), _max_output(max_output), _min_output(min_output),
+      _options(options), _alpha(dt / (options.derivative_filter + dt))
+{
+}
+
+void PIDBatch::setGains(std::size_t lane, double kp, double ki, double kd)
+{
+    _kp[lane] = kp;
+    _ki[lane] = ki;
+    _kd[lane] = kd;
+    _back_gain[lane] = backCalculationGain(kp, ki, _options);
+}
+
+void PIDBatch::calculate(const double *setpoint, const double *pv, double *output)
+{
+    const std::size_t n = size();
+    double *kp = _kp.data();
+    double *ki = _ki.data();
+    double *kd = _kd.data();
+    double *integral = _integral.data();
+    double *pre_error = _pre_error.data();
+    double *filtered_d = _derivative.data();
+    double *back_gain = _back_gain.data();
+    const bool filter = _options.derivative_filter > 0.0;
+    const bool on_measurement = _options.derivative_on_measurement;
+    const bool conditional = _options.anti_windup == AntiWindup::Conditional;
+    const bool back_calculation = _options.anti_windup == AntiWindup::BackCalculation;
+    std::size_t i = 0;
+
+    // Vector lanes keep the scalar operation order (no FMA, (P + I) + D) so
+    // the results match PID::calculate bit for bit. max(lo, x) / min(hi, x)
+    // return x for NaN inputs, like std::clamp does. Options become all-ones
+    // or all-zero masks and are applied with blends, the way PID selects.
+#if defined(__AVX__)
+    auto mask = [](bool on) { return _mm256_castsi256_pd(_mm256_set1_epi64x(on ? -1 : 0)); };
+    const __m256d dt = _mm256_set1_pd(_dt);
+    const __m256d hi = _mm256_set1_pd(_max_output);
+    const __m256d lo = _mm256_set1_pd(_min_output);
+    const __m256d alpha = _mm256_set1_pd(_alpha);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    const __m256d filter_on = mask(filter);
+    const __m256d measurement_on = mask(on_measurement);
+    const __m256d conditional_on = mask(conditional);
+    const __m256d back_on = mask(back_calculation);
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d p = _mm256_loadu_pd(pv + i);
+        __m256d error = _mm256_sub_pd(_mm256_loadu_pd(setpoint + i), p);
+        __m256d P = _mm256_mul_pd(_mm256_loadu_pd(kp + i), error);
+
+        __m256d old_integ = _mm256_loadu_pd(integral + i);
+        __m256d integ = _mm256_add_pd(old_integ, _mm256_mul_pd(error, dt));
+        __m256d I = _mm256_mul_pd(_mm256_loadu_pd(ki + i), integ);
+
+        __m256d d_input = _mm256_blendv_pd(error, _mm256_xor_pd(p, sign), measurement_on);
+        __m256d derivative = _mm256_div_pd(_mm256_sub_pd(d_input, _mm256_loadu_pd(pre_error + i)), dt);
+        __m256d prev_d = _mm256_loadu_pd(filtered_d + i);
+        __m256d filtered = _mm256_add_pd(prev_d, _mm256_mul_pd(alpha, _mm256_sub_pd(derivative, prev_d)));
+        derivative = _mm256_blendv_pd(derivative, filtered, filter_on);
+        __m256d D = _mm256_mul_pd(_mm256_loadu_pd(kd + i), derivative);
+
+        __m256d unclamped = _mm256_add_pd(_mm256_add_pd(P, I), D);
+        __m256d out = _mm256_min_pd(hi, _mm256_max_pd(lo, unclamped));
+        _mm256_storeu_pd(output + i, out);
+
+        __m256d hold = _mm256_and_pd(conditional_on,
+                                     _mm256_and_pd(_mm256_cmp_pd(unclamped, out, _CMP_NEQ_UQ),
+                                                   _mm256_cmp_pd(_mm256_mul_pd(error, unclamped), zero, _CMP_GT_OQ)));
+        __m256d back = _mm256_add_pd(
+            integ, _mm256_mul_pd(_mm256_mul_pd(_mm256_loadu_pd(back_gain + i), _mm256_sub_pd(out, unclamped)), dt));
+        integ = _mm256_blendv_pd(integ, old_integ, hold);
+        _mm256_storeu_pd(integral + i, _mm256_blendv_pd(integ, back, back_on));
+
+        _mm256_storeu_pd(pre_error + i, d_input);
+        _mm256_storeu_pd(filtered_d + i, derivative);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    auto mask = [](bool on) { return vdupq_n_u64(on ? ~0ULL : 0ULL); };
+    const float64x2_t dt = vdupq_n_f64(_dt);
+    const float64x2_t hi = vdupq_n_f64(_max_output);
+    const float64x2_t lo = vdupq_n_f64(_min_output);
+    const float64x2_t alpha = vdupq_n_f64(_alpha);
+    const float64x2_t zero = vdupq_n_f64(0.0);
+    const uint64x2_t filter_on = mask(filter);
+    const uint64x2_t measurement_on = mask(on_measurement);
+    const uint64x2_t conditional_on = mask(conditional);
+    const uint64x2_t back_on = mask(back_calculation);
+    for (; i + 2 <= n; i += 2)
+    {
+        float64x2_t p = vld1q_f64(pv + i);
+        float64x2_t error = vsubq_f64(vld1q_f64(setpoint + i), p);
+        float64x2_t P = vmulq_f64(vld1q_f64(kp + i), error);
+
+        float64x2_t old_integ = vld1q_f64(integral + i);
+        float64x2_t integ = vaddq_f64(old_integ, vmulq_f64(error, dt));
+        float64x2_t I = vmulq_f64(vld1q_f64(ki + i), integ);
+
+        float64x2_t d_input = vbslq_f64(measurement_on, vnegq_f64(p), error);
+        float64x2_t derivative = vdivq_f64(vsubq_f64(d_input, vld1q_f64(pre_error + i)), dt);
+        float64x2_t prev_d = vld1q_f64(filtered_d + i);
+        float64x2_t filtered = vaddq_f64(prev_d, vmulq_f64(alpha, vsubq_f64(derivative, prev_d)));
+        derivative = vbslq_f64(filter_on, filtered, derivative);
+        float64x2_t D = vmulq_f64(vld1q_f64(kd + i), derivative);
+
+        float64x2_t unclamped = vaddq_f64(vaddq_f64(P, I), D);
+        float64x2_t out = vminq_f64(hi, vmaxq_f64(lo, unclamped));
+        vst1q_f64(output + i, out);
+
+        uint64x2_t saturated = vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(vceqq_f64(unclamped, out))));
+        uint64x2_t hold = vandq_u64(conditional_on, vandq_u64(saturated, vcgtq_f64(vmulq_f64(error, unclamped), zero)));
+        float64x2_t back = vaddq_f64(integ, vmulq_f64(vmulq_f64(vld1q_f64(back_gain + i), vsubq_f64(out, unclamped)), dt));
+        integ = vbslq_f64(hold, old_integ, integ);
+        vst1q_f64(integral + i, vbslq_f64(back_on, back, integ));
+
+        vst1q_f64(pre_error + i, d_input);
+        vst1q_f64(filtered_d + i, derivative);
+    }
+#endif
+
+    // Scalar fallback / remainder: same steps as PID::calculate
+    for (; i < n; i++)
+    {
+        double error = setpoint[i] - pv[i];
+        double P = kp[i] * error;
+
+        double integ = integral[i] + error * _dt;
+        double I = ki[i] * integ;
+
+        double d_input = on_measurement ? -pv[i] : error;
+        double derivative = (d_input - pre_error[i]) / _dt;
+        double filtered = filtered_d[i] + _alpha * (derivative - filtered_d[i]);
+        derivative = filter ? filtered : derivative;
+        double D = kd[i] * derivative;
+
+        double unclamped = P + I + D;
+        double out = std::clamp(unclamped, _min_output, _max_output);
+        output[i] = out;
+
+        bool hold = conditional & (unclamped != out) & (error * unclamped > 0.0);
+        double back = integ + back_gain[i] * (out - unclamped) * _dt;
+        integ = hold ? integral[i] : integ;
+        integral[i] = back_calculation ? back : integ;
+
+        pre_error[i] = d_input;
+        filtered_d[i] = derivative;
+    }
+}
+
+void PIDBatch::reset()
+{
+    std::fill(_integral.begin(), _integral.end(), 0.0);
+    std::fill(_pre_error.begin(), _pre_error.end(), 0.0);
+    std::fill(_derivative.begin(), _derivative.end(), 0.0);
+}
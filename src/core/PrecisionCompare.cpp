@@ -0,0 +1,164 @@
+#include "PrecisionCompare.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include "BasicPID.hpp"
+#include "FixedPoint.hpp"
+#include "MockSensor.hpp"
+#include "PID.hpp"
+#include "Plant.hpp"
+
+namespace
+{
+    struct Flight
+    {
+        MetricsSummary metrics;
+        std::vector<double> actual; // Sensor reading per step
+        std::vector<double> output; // Command per step
+    };
+
+    // The mission loop, keeping the readings and commands
+    template <typename Controller>
+    Flight fly(Controller &controller, const MissionProfile &mission)
+    {
+        Flight flight;
+        flight.actual.reserve(mission.steps);
+        flight.output.reserve(mission.steps);
+
+        MockSensor altimeter(mission.initial_altitude, mission.noise);
+        Metrics metrics(mission);
+        withPlant(mission.plant, mission.initial_altitude, [&](auto &plant) {
+            for (int i = 0; i < mission.steps; i++)
+            {
+                double current_target = mission.targetAt(i);
+
+                double current_alt = altimeter.read();
+                double motor_power = controller.calculate(current_target, current_alt);
+                plant.step(motor_power, mission.dt);
+                altimeter.setValue(plant.altitude());
+
+                metrics.update(i, current_target, current_alt);
+                flight.actual.push_back(current_alt);
+                flight.output.push_back(motor_power);
+            }
+        });
+        flight.metrics = metrics.summary();
+        return flight;
+    }
+
+    double maxDifference(const std::vector<double> &a, const std::vector<double> &b)
+    {
+        double worst = 0.0;
+        for (std::size_t i = 0; i < a.size(); i++)
+            worst = std::max(worst, std::abs(a[i] - b[i]));
+        return worst;
+    }
+
+    // Best-of-repeats time of step() over the reference readings, inputs converted up front
+    template <typename Controller, typename T>
+    double timeSteps(Controller &controller, const std::vector<T> &setpoint, const std::vector<T> &pv, int repeats)
+    {
+        double best = std::numeric_limits<double>::infinity();
+        T sink = T(0.0);
+        for (int r = 0; r < std::max(repeats, 1); r++)
+        {
+            controller.reset();
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < pv.size(); i++)
+                sink += controller.step(setpoint[i], pv[i]);
+            auto end = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count());
+        }
+
+        // Keep the loop observable so it is not optimized away
+        volatile double observed = static_cast<double>(sink);
+        (void)observed;
+        return pv.empty() ? 0.0 : best / pv.size();
+    }
+
+    // PID has no native step(); its calculate() is the double path
+    struct ReferenceStepper
+    {
+        PID pid;
+        double step(double setpoint, double pv) { return pid.calculate(setpoint, pv); }
+        double calculate(double setpoint, double pv) { return pid.calculate(setpoint, pv); }
+        void reset() { pid.reset(); }
+    };
+
+    // prototype is copied fresh for each of the runs
+    template <typename T, typename Controller>
+    PrecisionReport compare(NumericType type, const Controller &prototype, const Flight &reference,
+                            const MissionProfile &mission, int repeats)
+    {
+        PrecisionReport report;
+        report.type = type;
+
+        // 1. Closed loop: its own flight, drifting from the reference as rounding accumulates
+        Controller closed = prototype;
+        Flight flight = fly(closed, mission);
+        report.metrics = flight.metrics;
+        report.max_altitude_error = maxDifference(flight.actual, reference.actual);
+
+        // 2. Open loop: the reference's readings, so only the controller arithmetic differs
+        Controller open = prototype;
+        std::vector<T> setpoint(mission.steps), pv(mission.steps);
+        std::vector<double> output(mission.steps);
+        for (int i = 0; i < mission.steps; i++)
+        {
+            setpoint[i] = T(mission.targetAt(i));
+            pv[i] = T(reference.actual[i]);
+            output[i] = static_cast<double>(open.step(setpoint[i], pv[i]));
+        }
+        report.max_output_error = maxDifference(output, reference.output);
+
+        // 3. Cost per step in the native type
+        report.ns_per_step = timeSteps(open, setpoint, pv, repeats);
+        return report;
+    }
+}
+
+const char *numericTypeName(NumericType type)
+{
+    switch (type)
+    {
+    case NumericType::Reference:
+        return "pid";
+    case NumericType::Double:
+        return "double";
+    case NumericType::Float:
+        return "float";
+    case NumericType::Q16_16:
+        return "q16.16";
+    case NumericType::Q12_20:
+    default:
+        return "q12.20";
+    }
+}
+
+std::vector<PrecisionReport> comparePrecision(const PIDGains &gains, const MissionProfile &profile, int repeats)
+{
+    // A negative step count flies nothing (and must not size the traces)
+    MissionProfile mission = profile;
+    mission.steps = std::max(mission.steps, 0);
+    const MissionProfile &m = mission;
+    ReferenceStepper reference_pid{PID(gains.kp, gains.ki, gains.kd, m.dt, m.max_output, m.min_output)};
+    Flight reference = fly(reference_pid, mission);
+    reference_pid.reset();
+
+    std::vector<PrecisionReport> reports;
+    reports.push_back(compare<double>(NumericType::Reference, reference_pid, reference, mission, repeats));
+    reports.push_back(compare<double>(NumericType::Double,
+                                      BasicPID<double>(gains.kp, gains.ki, gains.kd, m.dt, m.max_output, m.min_output),
+                                      reference, mission, repeats));
+    reports.push_back(compare<float>(NumericType::Float,
+                                     BasicPID<float>(gains.kp, gains.ki, gains.kd, m.dt, m.max_output, m.min_output),
+                                     reference, mission, repeats));
+    reports.push_back(compare<Q16_16>(NumericType::Q16_16,
+                                      BasicPID<Q16_16>(gains.kp, gains.ki, gains.kd, m.dt, m.max_output, m.min_output),
+                                      reference, mission, repeats));
+    reports.push_back(compare<Q12_20>(NumericType::Q12_20,
+                                      BasicPID<Q12_20>(gains.kp, gains.ki, gains.kd, m.dt, m.max_output, m.min_output),
+                                      reference, mission, repeats));
+    return reports;
+}
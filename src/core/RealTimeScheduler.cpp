@@ -0,0 +1,120 @@
+#include "RealTimeScheduler.hpp"
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+RealTimeScheduler::RealTimeScheduler(const RealTimeConfig &config)
+    : _config(config),
+      _period(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / config.rate_hz))),
+      _started(false)
+{
+}
+
+bool RealTimeScheduler::applyThreadSettings(std::string &error)
+{
+    bool ok = true;
+#ifdef __linux__
+    if (_config.cpu >= 0)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(_config.cpu, &set);
+        int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        if (rc != 0)
+        {
+            error += "CPU pinning failed: " + std::string(std::strerror(rc)) + ". ";
+            ok = false;
+        }
+    }
+    if (_config.fifo)
+    {
+        sched_param param;
+        param.sched_priority = _config.fifo_priority;
+        int rc = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (rc != 0)
+        {
+            error += "SCHED_FIFO failed: " + std::string(std::strerror(rc)) + ". ";
+            ok = false;
+        }
+    }
+#else
+    if (_config.cpu >= 0 || _config.fifo)
+    {
+        error = "CPU pinning and SCHED_FIFO are only supported on Linux.";
+        ok = false;
+    }
+#endif
+    return ok;
+}
+
+void RealTimeScheduler::start()
+{
+    _deadline = Clock::now() + _period;
+    _started = false;
+}
+
+void RealTimeScheduler::sleepUntil(Clock::time_point wake)
+{
+#ifdef __linux__
+    // steady_clock is CLOCK_MONOTONIC on Linux, so its epoch matches
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(wake.time_since_epoch()).count();
+    timespec ts;
+    ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+    ts.tv_nsec = static_cast<long>(ns % 1000000000);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+    {
+    }
+#else
+    std::this_thread::sleep_until(wake);
+#endif
+}
+
+void RealTimeScheduler::waitNextTick()
+{
+    Clock::time_point now = Clock::now();
+
+    // 1. Account for the work done since the previous wake-up
+    if (_started)
+    {
+        _stats.tick_duration.record(std::chrono::duration_cast<std::chrono::nanoseconds>(now - _tick_start).count());
+        if (now > _deadline)
+        {
+            // Overran: count every deadline we slipped past and re-align the
+            // schedule to the next future slot instead of bursting to catch up
+            auto missed = (now - _deadline) / _period + 1;
+            _stats.deadline_misses += missed;
+            _deadline += missed * _period;
+        }
+    }
+    _started = true;
+
+    // 2. Coarse sleep, then spin the last few microseconds
+    Clock::time_point spin_from = _deadline - std::chrono::nanoseconds(_config.spin_ns);
+    if (now < spin_from)
+        sleepUntil(spin_from);
+    while (Clock::now() < _deadline)
+    {
+    }
+
+    // 3. Record how late we actually started
+    _tick_start = Clock::now();
+    _stats.wakeup_latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(_tick_start - _deadline).count());
+    _stats.ticks++;
+    _deadline += _period;
+}
+
+void writeRealTimeSummaryCsv(std::ostream &out, const RealTimeConfig &config, const RealTimeStats &stats)
+{
+    auto us = [](std::uint64_t ns) { return ns / 1000.0; };
+    out << "Rate,Ticks,DeadlineMisses,LatencyP50Us,LatencyP99Us,LatencyP999Us,LatencyMaxUs,TickP99Us\n";
+    out << config.rate_hz << "," << stats.ticks << "," << stats.deadline_misses << ","
+        << us(stats.wakeup_latency.percentile(0.5)) << "," << us(stats.wakeup_latency.percentile(0.99)) << ","
+        << us(stats.wakeup_latency.percentile(0.999)) << "," << us(stats.wakeup_latency.max()) << ","
+        << us(stats.tick_duration.percentile(0.99)) << "\n";
+}
@@ -0,0 +1,140 @@
+#include "ResultCache.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+
+namespace
+{
+    const char kCacheMagic[4] = {'A', 'R', 'C', '1'};
+
+    template <typename T>
+    void append(std::string &bytes, const T &value)
+    {
+        bytes.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+}
+
+std::uint64_t fnv1a(const void *data, std::size_t size, std::uint64_t hash)
+{
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+SimulationKey makeSimulationKey(const PIDGains &gains, const MissionProfile &mission)
+{
+    // Field by field, so struct padding never leaks into the key
+    SimulationKey key;
+    append(key.bytes, gains.kp);
+    append(key.bytes, gains.ki);
+    append(key.bytes, gains.kd);
+    append(key.bytes, mission.steps);
+    append(key.bytes, mission.target1);
+    append(key.bytes, mission.target2);
+    append(key.bytes, mission.switch_step);
+    append(key.bytes, mission.dt);
+    append(key.bytes, mission.max_output);
+    append(key.bytes, mission.min_output);
+    append(key.bytes, mission.initial_altitude);
+    append(key.bytes, static_cast<int>(mission.noise.distribution));
+    append(key.bytes, mission.noise.amplitude);
+    append(key.bytes, mission.noise.seed);
+    const VehicleParams &vehicle = mission.plant.vehicle;
+    append(key.bytes, static_cast<int>(mission.plant.type));
+    append(key.bytes, static_cast<int>(mission.plant.integrator));
+    append(key.bytes, mission.plant.substeps);
+    append(key.bytes, mission.pid.derivative_filter);
+    append(key.bytes, static_cast<int>(mission.pid.derivative_on_measurement));
+    append(key.bytes, static_cast<int>(mission.pid.anti_windup));
+    append(key.bytes, mission.pid.back_calculation_gain);
+    for (double value : {vehicle.mass, vehicle.gravity, vehicle.thrust_gain, vehicle.max_thrust, vehicle.drag, vehicle.motor_tau})
+        append(key.bytes, value);
+    key.hash = fnv1a(key.bytes.data(), key.bytes.size());
+    return key;
+}
+
+SimulationKey makeSimulationKey(const PIDGains &gains, const MissionProfile &mission, const RunLimits &limits)
+{
+    SimulationKey key = makeSimulationKey(gains, mission);
+    key.bytes.push_back('L'); // Never a prefix clash with an unlimited key of the same mission
+    append(key.bytes, limits.max_saturated_steps);
+    append(key.bytes, limits.max_tracking_error);
+    key.hash = fnv1a(key.bytes.data(), key.bytes.size());
+    return key;
+}
+
+ResultCache::ResultCache(std::size_t capacity, const std::string &directory)
+    : _memory(capacity), _directory(directory), _stats{0, 0, 0}
+{
+}
+
+std::string ResultCache::pathFor(const SimulationKey &key) const
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.arc", static_cast<unsigned long long>(key.hash));
+    return _directory + "/" + name;
+}
+
+bool ResultCache::find(const SimulationKey &key, MetricsSummary &metrics)
+{
+    // 1. Memory
+    if (const MetricsSummary *cached = _memory.find(key))
+    {
+        metrics = *cached;
+        _stats.hits++;
+        return true;
+    }
+
+    // 2. Disk: magic, key size, key bytes, summary
+    if (!_directory.empty())
+    {
+        std::ifstream file(pathFor(key), std::ios::binary);
+        char magic[4];
+        std::uint32_t key_size = 0;
+        if (file.read(magic, sizeof(magic)) && std::memcmp(magic, kCacheMagic, sizeof(magic)) == 0 &&
+            file.read(reinterpret_cast<char *>(&key_size), sizeof(key_size)) && key_size == key.bytes.size())
+        {
+            std::string stored(key_size, '\0');
+            MetricsSummary summary;
+            if (file.read(&stored[0], key_size) && stored == key.bytes &&
+                file.read(reinterpret_cast<char *>(&summary), sizeof(summary)))
+            {
+                _memory.insert(key, summary);
+                metrics = summary;
+                _stats.disk_hits++;
+                return true;
+            }
+        }
+    }
+
+    _stats.misses++;
+    return false;
+}
+
+void ResultCache::store(const SimulationKey &key, const MetricsSummary &metrics)
+{
+    _memory.insert(key, metrics);
+    if (_directory.empty())
+        return;
+
+    // Write to a temporary name first so a concurrent reader never sees half a file
+    const std::string path = pathFor(key);
+    const std::string temp = path + ".tmp";
+    std::ofstream file(temp, std::ios::binary);
+    std::uint32_t key_size = static_cast<std::uint32_t>(key.bytes.size());
+    file.write(kCacheMagic, sizeof(kCacheMagic));
+    file.write(reinterpret_cast<const char *>(&key_size), sizeof(key_size));
+    file.write(key.bytes.data(), key.bytes.size());
+    file.write(reinterpret_cast<const char *>(&metrics), sizeof(metrics));
+    file.close();
+
+    if (file)
+        std::rename(temp.c_str(), path.c_str());
+    else
+        std::remove(temp.c_str()); // Missing directory or full disk: memory only
+}
@@ -0,0 +1,171 @@
+#include "SimulationServer.hpp"
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "Metrics.hpp"
+#include "Optimizers.hpp"
+#include "Simulation.hpp"
+#include "Telemetry.hpp"
+#include "TelemetryBuffer.hpp"
+#include "TelemetryDownsampler.hpp"
+#include "Tuner.hpp"
+
+namespace
+{
+    // Parses "<kp> <ki> <kd> <steps> <t1> <t2> <switch> [seed]" starting at tokens[first]
+    void parseRun(const std::vector<std::string> &tokens, std::size_t first, PIDGains &gains, MissionProfile &mission)
+    {
+        if (tokens.size() < first + 7)
+            throw std::invalid_argument("expected <kp> <ki> <kd> <steps> <t1> <t2> <switch> [seed]");
+
+        gains = {std::stod(tokens[first]), std::stod(tokens[first + 1]), std::stod(tokens[first + 2])};
+        mission.steps = std::stoi(tokens[first + 3]);
+        mission.target1 = std::stod(tokens[first + 4]);
+        mission.target2 = std::stod(tokens[first + 5]);
+        mission.switch_step = std::stoi(tokens[first + 6]);
+        if (tokens.size() > first + 7)
+            mission.noise.seed = std::stoull(tokens[first + 7]);
+    }
+
+    void writeMetrics(std::ostream &out, const MetricsSummary &m)
+    {
+        out << "ok " << m.rmse << " " << m.overshoot_percent << " " << m.settling_time << " " << m.samples << "\n";
+    }
+}
+
+SimulationServer::SimulationServer(const std::string &cache_directory) : _metrics(4096, cache_directory)
+{
+}
+
+const TelemetryBuffer &SimulationServer::trace(const PIDGains &gains, const MissionProfile &mission)
+{
+    // Same run as last time: the buffer still holds it. Otherwise fly into the
+    // same arena, which only grows when a longer mission comes in.
+    const SimulationKey key = makeSimulationKey(gains, mission);
+    if (key.bytes == _trace_key)
+        return _trace;
+
+    simulate(gains, mission, _trace);
+    _trace_key = key.bytes;
+    return _trace;
+}
+
+int SimulationServer::serve(std::istream &in, std::ostream &out)
+{
+    out << std::setprecision(10);
+
+    int handled = 0;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+        handled++;
+        bool keep_going = handle(line, out);
+        out.flush(); // The client blocks on each reply
+        if (!keep_going)
+            break;
+    }
+    return handled;
+}
+
+bool SimulationServer::handle(const std::string &line, std::ostream &out)
+{
+    std::istringstream stream(line);
+    std::vector<std::string> tokens;
+    for (std::string token; stream >> token;)
+        tokens.push_back(token);
+    if (tokens.empty())
+        return true;
+
+    const std::string &command = tokens[0];
+    try
+    {
+        PIDGains gains;
+        MissionProfile mission;
+
+        if (command == "quit")
+            return false;
+
+        if (command == "ping")
+        {
+            out << "ok pong\n";
+        }
+        else if (command == "metrics")
+        {
+            parseRun(tokens, 1, gains, mission);
+            const SimulationKey key = makeSimulationKey(gains, mission);
+            MetricsSummary metrics;
+            if (!_metrics.find(key, metrics))
+            {
+                metrics = simulateMetrics(gains, mission);
+                _metrics.store(key, metrics);
+            }
+            writeMetrics(out, metrics);
+        }
+        else if (command == "record" || command == "plot" || command == "trace")
+        {
+            bool record = (command != "trace");
+            bool plot = (command == "plot");
+            if (record && tokens.size() < 2)
+                throw std::invalid_argument("expected <path>");
+            if (plot && tokens.size() < 3)
+                throw std::invalid_argument("expected <path> <max_points>");
+            parseRun(tokens, plot ? 3 : (record ? 2 : 1), gains, mission);
+
+            const TelemetryBuffer &trace = this->trace(gains, mission);
+            const double *time = trace.time(), *target = trace.target(), *actual = trace.actual(), *output = trace.output();
+            Metrics metrics(mission);
+            for (std::size_t i = 0; i < trace.size(); i++)
+                metrics.update(static_cast<int>(i), target[i], actual[i]);
+
+            if (record)
+            {
+                // Metrics above come from every step; only the file is downsampled
+                std::size_t max_points = plot ? std::stoul(tokens[2]) : 0;
+                DownsamplingTelemetryWriter writer(
+                    std::make_unique<BinaryTelemetryWriter>(tokens[1], mission.dt, trace.size()), trace.size(), max_points);
+                for (std::size_t i = 0; i < trace.size(); i++)
+                    writer.write({time[i], target[i], actual[i], output[i]});
+                writer.close();
+                writeMetrics(out, metrics.summary());
+            }
+            else
+            {
+                out << "ok " << trace.size() << "\n";
+                for (std::size_t i = 0; i < trace.size(); i++)
+                    out << time[i] << "," << target[i] << "," << actual[i] << "," << output[i] << "\n";
+                out << "end\n";
+            }
+        }
+        else if (command == "tune")
+        {
+            if (tokens.size() < 6)
+                throw std::invalid_argument("expected <steps> <t1> <t2> <switch> <accuracy|balanced> [method]");
+            mission.steps = std::stoi(tokens[1]);
+            mission.target1 = std::stod(tokens[2]);
+            mission.target2 = std::stod(tokens[3]);
+            mission.switch_step = std::stoi(tokens[4]);
+
+            OptimizerConfig config;
+            config.method = OptimizerMethod::Twiddle;
+            config.strategy = (tokens[5] == "balanced") ? TuningStrategy::Balanced : TuningStrategy::Accuracy;
+            config.cache = &_metrics;
+            if (tokens.size() > 6 && !parseOptimizerMethod(tokens[6], config.method))
+                throw std::invalid_argument("unknown method '" + tokens[6] + "'");
+            TuningResult result = optimizeGains(mission, config);
+            out << "ok " << result.gains.kp << " " << result.gains.ki << " " << result.gains.kd << " " << result.cost << "\n";
+        }
+        else
+        {
+            out << "error unknown command '" << command << "'\n";
+        }
+    }
+    catch (const std::exception &e)
+    {
+        out << "error " << command << ": " << e.what() << "\n";
+    }
+    return true;
+}
@@ -0,0 +1,43 @@
+#include "Sweep.hpp"
+#include <algorithm>
+#include "Simulation.hpp"
+#include "ThreadPool.hpp"
+
+std::vector<SweepResult> runSweep(const MissionProfile &mission, const SweepConfig &config)
+{
+    const std::size_t nkp = std::max(config.kp.count, 0);
+    const std::size_t nki = std::max(config.ki.count, 0);
+    const std::size_t nkd = std::max(config.kd.count, 0);
+    const std::size_t total = nkp * nki * nkd;
+
+    // 1. Enumerate the grid (Kd fastest)
+    std::vector<SweepResult> results(total);
+    for (std::size_t c = 0; c < total; c++)
+    {
+        int a = static_cast<int>(c / (nki * nkd));
+        int b = static_cast<int>((c / nkd) % nki);
+        int d = static_cast<int>(c % nkd);
+        results[c].gains = {config.kp.at(a), config.ki.at(b), config.kd.at(d)};
+    }
+
+    // 2. Each chunk is simulated independently (own controllers and sensors)
+    ThreadPool pool(config.threads);
+    pool.parallelFor(total, config.chunk, [&](std::size_t begin, std::size_t end) {
+        std::vector<PIDGains> candidates;
+        candidates.reserve(end - begin);
+        for (std::size_t c = begin; c < end; c++)
+            candidates.push_back(results[c].gains);
+
+        std::vector<MetricsSummary> metrics = simulateBatch(candidates, mission);
+        for (std::size_t c = begin; c < end; c++)
+        {
+            results[c].metrics = metrics[c - begin];
+            results[c].cost = missionCost(metrics[c - begin], config.strategy);
+        }
+    });
+
+    // 3. Rank
+    std::stable_sort(results.begin(), results.end(),
+                     [](const SweepResult &x, const SweepResult &y) { return x.cost < y.cost; });
+    return results;
+}
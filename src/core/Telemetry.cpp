@@ -0,0 +1,220 @@
+#include "Telemetry.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    const char kMagic[8] = {'A', 'E', 'R', 'O', 'T', 'L', 'M', '\0'};
+    const char *kColumnNames[BinaryTelemetryWriter::kColumnCount] = {"Time", "Target", "Actual", "Output"};
+
+    struct BinaryHeader
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t value_size;
+        std::uint32_t column_count;
+        std::uint32_t header_size;
+        double dt;
+        std::uint64_t steps;
+        char reserved[24];
+    };
+    static_assert(sizeof(BinaryHeader) == BinaryTelemetryWriter::kHeaderSize, "Header layout must stay 64 bytes");
+}
+
+// --- Tee ---
+
+TeeTelemetryWriter::TeeTelemetryWriter(std::unique_ptr<TelemetryWriter> first, std::unique_ptr<TelemetryWriter> second)
+    : _first(std::move(first)), _second(std::move(second))
+{
+}
+
+void TeeTelemetryWriter::write(const TelemetryRecord &record)
+{
+    _first->write(record);
+    _second->write(record);
+}
+
+void TeeTelemetryWriter::writeBlock(const TelemetryRecord *records, std::size_t count)
+{
+    _first->writeBlock(records, count);
+    _second->writeBlock(records, count);
+}
+
+void TeeTelemetryWriter::close()
+{
+    _first->close();
+    _second->close();
+}
+
+// --- CSV ---
+
+CsvTelemetryWriter::CsvTelemetryWriter(const std::string &path) : _file(path)
+{
+    _file << "Time,Target,Actual,Output\n";
+}
+
+CsvTelemetryWriter::~CsvTelemetryWriter()
+{
+    close();
+}
+
+void CsvTelemetryWriter::write(const TelemetryRecord &record)
+{
+    if (_file.is_open())
+        _file << record.time << "," << record.target << "," << record.actual << "," << record.output << "\n";
+}
+
+void CsvTelemetryWriter::writeBlock(const TelemetryRecord *records, std::size_t count)
+{
+    if (!_file.is_open())
+        return;
+
+    // Format the whole block in memory, then hand it to the file in one write
+    _block.str(std::string());
+    for (std::size_t i = 0; i < count; i++)
+        _block << records[i].time << "," << records[i].target << "," << records[i].actual << "," << records[i].output << "\n";
+    const std::string text = _block.str();
+    _file.write(text.data(), text.size());
+}
+
+void CsvTelemetryWriter::close()
+{
+    if (_file.is_open())
+        _file.close();
+}
+
+// --- Binary ---
+
+BinaryTelemetryWriter::BinaryTelemetryWriter(const std::string &path, double dt, std::size_t expected_steps,
+                                             TelemetryPrecision precision)
+    : _path(path), _dt(dt), _precision(precision), _closed(false)
+{
+    for (std::vector<double> &column : _columns)
+        column.reserve(expected_steps);
+}
+
+BinaryTelemetryWriter::~BinaryTelemetryWriter()
+{
+    close();
+}
+
+void BinaryTelemetryWriter::write(const TelemetryRecord &record)
+{
+    if (_closed)
+        return;
+    _columns[0].push_back(record.time);
+    _columns[1].push_back(record.target);
+    _columns[2].push_back(record.actual);
+    _columns[3].push_back(record.output);
+}
+
+void BinaryTelemetryWriter::close()
+{
+    if (_closed)
+        return;
+    _closed = true;
+
+    if (_precision == TelemetryPrecision::Float32)
+        writeColumns<float>();
+    else
+        writeColumns<double>();
+}
+
+template <typename T>
+void BinaryTelemetryWriter::writeColumns()
+{
+    std::ofstream file(_path, std::ios::binary);
+
+    // 1. Fixed header
+    BinaryHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.value_size = sizeof(T);
+    header.column_count = kColumnCount;
+    header.header_size = kHeaderSize + kColumnCount * kColumnNameSize;
+    header.dt = _dt;
+    header.steps = _columns[0].size();
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    // 2. Schema
+    for (const char *name : kColumnNames)
+    {
+        char padded[kColumnNameSize] = {};
+        std::strncpy(padded, name, kColumnNameSize - 1);
+        file.write(padded, kColumnNameSize);
+    }
+
+    // 3. Columns, converted once on the way out
+    std::vector<T> buffer(_columns[0].size());
+    for (const std::vector<double> &column : _columns)
+    {
+        for (std::size_t i = 0; i < column.size(); i++)
+            buffer[i] = static_cast<T>(column[i]);
+        file.write(reinterpret_cast<const char *>(buffer.data()), buffer.size() * sizeof(T));
+    }
+}
+
+// --- Reader ---
+
+namespace
+{
+    template <typename T>
+    void readColumn(std::ifstream &file, std::vector<double> &column, std::uint64_t steps)
+    {
+        std::vector<T> buffer(steps);
+        file.read(reinterpret_cast<char *>(buffer.data()), steps * sizeof(T));
+        column.assign(buffer.begin(), buffer.end());
+    }
+}
+
+bool parseBinaryTelemetryHeader(const void *data, std::size_t size, BinaryTelemetryLayout &layout)
+{
+    BinaryHeader header;
+    if (size < sizeof(header))
+        return false;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+        return false;
+    if (header.column_count != BinaryTelemetryWriter::kColumnCount || (header.value_size != 4 && header.value_size != 8))
+        return false;
+    // Columns are read in place, so they must start on a double boundary
+    if (header.header_size < sizeof(header) || header.header_size > size || header.header_size % alignof(double) != 0 ||
+        header.steps > (size - header.header_size) / (header.value_size * BinaryTelemetryWriter::kColumnCount))
+        return false;
+
+    layout = {header.value_size, header.header_size, header.dt, header.steps};
+    return true;
+}
+
+MissionTrace readBinaryTelemetry(const std::string &path, double *dt)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        throw std::runtime_error("Cannot open telemetry file: " + path);
+
+    BinaryHeader header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+        throw std::runtime_error("Not a binary telemetry file: " + path);
+    if (header.column_count != BinaryTelemetryWriter::kColumnCount || (header.value_size != 4 && header.value_size != 8))
+        throw std::runtime_error("Unsupported telemetry layout: " + path);
+
+    file.seekg(header.header_size);
+
+    MissionTrace trace;
+    std::vector<double> *columns[] = {&trace.time, &trace.target, &trace.actual, &trace.output};
+    for (std::vector<double> *column : columns)
+    {
+        if (header.value_size == 4)
+            readColumn<float>(file, *column, header.steps);
+        else
+            readColumn<double>(file, *column, header.steps);
+    }
+    if (!file)
+        throw std::runtime_error("Truncated telemetry file: " + path);
+
+    if (dt)
+        *dt = header.dt;
+    return trace;
+}
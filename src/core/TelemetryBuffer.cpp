@@ -0,0 +1,61 @@
+#include "TelemetryBuffer.hpp"
+#include "MockSensor.hpp"
+#include "PID.hpp"
+#include "Plant.hpp"
+
+TelemetryBuffer::TelemetryBuffer(std::size_t capacity)
+    : _capacity(0), _size(0), _dropped(0), _allocations(0),
+      _time(nullptr), _target(nullptr), _actual(nullptr), _output(nullptr)
+{
+    reserve(capacity);
+}
+
+void TelemetryBuffer::reserve(std::size_t steps)
+{
+    if (steps <= _capacity)
+        return;
+
+    // One block, four columns
+    _arena.reset(new double[4 * steps]);
+    _capacity = steps;
+    _size = 0;
+    _allocations++;
+    _time = _arena.get();
+    _target = _time + steps;
+    _actual = _target + steps;
+    _output = _actual + steps;
+}
+
+MissionTrace TelemetryBuffer::toTrace() const
+{
+    MissionTrace trace;
+    trace.time.assign(_time, _time + _size);
+    trace.target.assign(_target, _target + _size);
+    trace.actual.assign(_actual, _actual + _size);
+    trace.output.assign(_output, _output + _size);
+    return trace;
+}
+
+void simulate(const PIDGains &gains, const MissionProfile &mission, TelemetryBuffer &buffer)
+{
+    buffer.reserve(mission.steps > 0 ? static_cast<std::size_t>(mission.steps) : 0);
+    buffer.reset();
+
+    PID pid(gains.kp, gains.ki, gains.kd, mission.dt, mission.max_output, mission.min_output, mission.pid);
+    MockSensor altimeter(mission.initial_altitude, mission.noise);
+
+    // Same loop as simulate(gains, mission); the plant lives on the stack, so reuse stays allocation-free
+    withPlant(mission.plant, mission.initial_altitude, [&](auto &plant) {
+        for (int i = 0; i < mission.steps; i++)
+        {
+            double current_target = mission.targetAt(i);
+
+            double current_alt = altimeter.readValue();
+            double motor_power = pid.calculate(current_target, current_alt);
+            plant.step(motor_power, mission.dt);
+            altimeter.setValue(plant.altitude());
+
+            buffer.write({i * mission.dt, current_target, current_alt, motor_power});
+        }
+    });
+}
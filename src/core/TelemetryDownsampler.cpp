@@ -0,0 +1,84 @@
+#include "TelemetryDownsampler.hpp"
+
+DownsamplingTelemetryWriter::DownsamplingTelemetryWriter(std::unique_ptr<TelemetryWriter> backend,
+                                                         std::size_t expected_steps, std::size_t max_points,
+                                                         DownsampleMode mode)
+    : _backend(std::move(backend)), _mode(mode), _stride(1), _counter(0), _emitted(0), _closed(false),
+      _bucket_fill(0), _min{}, _max{}, _min_index(0), _max_index(0)
+{
+    if (max_points == 0 || max_points >= expected_steps)
+        return;
+
+    // A single point has no room for a min/max pair: keep the first record instead
+    if (max_points < 2)
+        _mode = DownsampleMode::Decimate;
+
+    // Two points per MinMax bucket, one per Decimate stride
+    std::size_t per_point = (_mode == DownsampleMode::MinMax) ? 2 : 1;
+    std::size_t outputs = max_points / per_point;
+    _stride = (expected_steps + outputs - 1) / outputs;
+}
+
+DownsamplingTelemetryWriter::~DownsamplingTelemetryWriter()
+{
+    close();
+}
+
+void DownsamplingTelemetryWriter::write(const TelemetryRecord &record)
+{
+    if (_closed)
+        return;
+
+    const std::size_t index = _counter++;
+    if (_stride == 1 || _mode == DownsampleMode::Decimate)
+    {
+        if (index % _stride == 0)
+        {
+            _backend->write(record);
+            _emitted++;
+        }
+        return;
+    }
+
+    // MinMax: track the bucket extremes by altitude
+    if (_bucket_fill == 0 || record.actual < _min.actual)
+    {
+        _min = record;
+        _min_index = index;
+    }
+    if (_bucket_fill == 0 || record.actual > _max.actual)
+    {
+        _max = record;
+        _max_index = index;
+    }
+    if (++_bucket_fill == _stride)
+        flushBucket();
+}
+
+void DownsamplingTelemetryWriter::flushBucket()
+{
+    if (_bucket_fill == 0)
+        return;
+
+    if (_min_index == _max_index)
+    {
+        _backend->write(_min);
+        _emitted++;
+    }
+    else
+    {
+        _backend->write(_min_index < _max_index ? _min : _max);
+        _backend->write(_min_index < _max_index ? _max : _min);
+        _emitted += 2;
+    }
+    _bucket_fill = 0;
+}
+
+void DownsamplingTelemetryWriter::close()
+{
+    if (_closed)
+        return;
+    flushBucket();
+    _backend->close();
+    _closed = true;
+}
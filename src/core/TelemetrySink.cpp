@@ -0,0 +1,85 @@
+#include "TelemetrySink.hpp"
+#include <chrono>
+#include <vector>
+
+TelemetrySink::TelemetrySink(std::unique_ptr<TelemetryWriter> backend, std::size_t capacity, OverflowPolicy policy,
+                             std::size_t block)
+    : _backend(std::move(backend)), _ring(capacity), _policy(policy), _block(block ? block : 1),
+      _stop(false), _pushed(0), _written(0), _dropped(0), _stalls(0), _high_water(0),
+      _thread(&TelemetrySink::run, this)
+{
+}
+
+TelemetrySink::~TelemetrySink()
+{
+    close();
+}
+
+void TelemetrySink::write(const TelemetryRecord &record)
+{
+    // Closed: nobody drains the ring any more, so the record goes nowhere
+    if (_stop.load(std::memory_order_relaxed))
+    {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (_ring.tryPush(record))
+    {
+        _pushed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    _stalls.fetch_add(1, std::memory_order_relaxed);
+    if (_policy == OverflowPolicy::Drop)
+    {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Backpressure: the writer thread is behind, wait for a free slot
+    while (!_ring.tryPush(record))
+        std::this_thread::yield();
+    _pushed.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TelemetrySink::close()
+{
+    if (!_thread.joinable())
+        return;
+    _stop.store(true, std::memory_order_release);
+    _thread.join();
+    _backend->close();
+}
+
+TelemetrySinkStats TelemetrySink::stats() const
+{
+    return {_pushed.load(), _written.load(), _dropped.load(), _stalls.load(), _high_water.load()};
+}
+
+void TelemetrySink::run()
+{
+    std::vector<TelemetryRecord> block(_block);
+
+    for (;;)
+    {
+        // Read the flag before draining so nothing pushed before close() is missed
+        bool stopping = _stop.load(std::memory_order_acquire);
+
+        std::size_t occupancy = _ring.size();
+        if (occupancy > _high_water.load(std::memory_order_relaxed))
+            _high_water.store(occupancy, std::memory_order_relaxed);
+
+        std::size_t count = _ring.popBulk(block.data(), block.size());
+        if (count > 0)
+        {
+            _backend->writeBlock(block.data(), count);
+            _written.fetch_add(count, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (stopping)
+            return;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
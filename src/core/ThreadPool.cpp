@@ -0,0 +1,116 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+ThreadPool::ThreadPool(std::size_t threads)
+    : _queued(0), _pending(0), _next(0), _stop(false)
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (std::size_t i = 0; i < threads; i++)
+        _queues.push_back(std::make_unique<Queue>());
+    for (std::size_t i = 0; i < threads; i++)
+        _threads.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _work.notify_all();
+    for (std::thread &t : _threads)
+        t.join();
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    _pending++;
+    Queue &queue = *_queues[_next++ % _queues.size()];
+    {
+        // Holding _mutex keeps _queued in step with the queues: a worker that
+        // grabs this task cannot decrement the counter before it is counted.
+        std::lock_guard<std::mutex> lock(_mutex);
+        {
+            std::lock_guard<std::mutex> queue_lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        _queued++;
+    }
+    _work.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _finished.wait(lock, [this]() { return _pending == 0; });
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t grain, const std::function<void(std::size_t, std::size_t)> &body)
+{
+    grain = std::max<std::size_t>(grain, 1);
+    for (std::size_t begin = 0; begin < count; begin += grain)
+    {
+        std::size_t end = std::min(count, begin + grain);
+        submit([&body, begin, end]() { body(begin, end); });
+    }
+    wait();
+}
+
+bool ThreadPool::tryTake(std::size_t index, std::function<void()> &task)
+{
+    // 1. Own queue first (newest task, still hot in cache)
+    {
+        Queue &own = *_queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // 2. Steal the oldest task from another worker
+    for (std::size_t k = 1; k < _queues.size(); k++)
+    {
+        Queue &victim = *_queues[(index + k) % _queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(std::size_t index)
+{
+    for (;;)
+    {
+        std::function<void()> task;
+        if (tryTake(index, task))
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _queued--;
+            }
+            task();
+
+            if (--_pending == 0)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _finished.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _work.wait(lock, [this]() { return _stop || _queued > 0; });
+        if (_stop && _queued == 0)
+            return;
+    }
+}
@@ -0,0 +1,123 @@
+#include "Tuner.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    const double kUnsettledPenalty = 100.0;
+    const double kSettlingWeight = 0.5;
+}
+
+double missionCost(const MetricsSummary &metrics, TuningStrategy strategy)
+{
+    if (strategy == TuningStrategy::Accuracy)
+        return metrics.rmse;
+
+    double time_penalty = std::isinf(metrics.settling_time) ? kUnsettledPenalty : metrics.settling_time * kSettlingWeight;
+    return metrics.rmse + time_penalty;
+}
+
+Tuner::Tuner(const MissionProfile &mission, const TunerConfig &config)
+    : _mission(mission), _config(config), _evaluations(0), _aborted(0), _cache_hits(0), _steps(0),
+      _own_cache(config.cache ? 0 : config.cache_capacity), _cache(config.cache ? config.cache : &_own_cache)
+{
+}
+
+double Tuner::evaluate(const PIDGains &gains, double bound)
+{
+    if (_mission.steps <= 0)
+        return std::numeric_limits<double>::infinity();
+
+    // 1. Seen before: the result is fully determined by gains, mission and
+    //    (with early termination) the divergence limits it was judged under
+    const SimulationKey key = _config.early_termination ? makeSimulationKey(gains, _mission, _config.limits)
+                                                        : makeSimulationKey(gains, _mission);
+    MetricsSummary cached;
+    if (_cache->find(key, cached))
+    {
+        _cache_hits++;
+        return missionCost(cached, _config.strategy);
+    }
+
+    // 2. Every candidate gets a fresh sensor seeded from the mission, so all
+    //    of them are compared against identical noise.
+    _evaluations++;
+    if (!_config.early_termination)
+    {
+        _steps += _mission.steps;
+        MetricsSummary metrics = simulateMetrics(gains, _mission);
+        _cache->store(key, metrics);
+        return missionCost(metrics, _config.strategy);
+    }
+
+    RunLimits limits = _config.limits;
+    limits.rmse_bound = bound;
+    RunResult run = simulateBounded(gains, _mission, limits);
+    _steps += run.steps;
+    if (run.status != RunStatus::Completed)
+    {
+        _aborted++; // Partial results are not cached
+        return std::numeric_limits<double>::infinity();
+    }
+    _cache->store(key, run.metrics);
+    return missionCost(run.metrics, _config.strategy);
+}
+
+TuningResult Tuner::run()
+{
+    _evaluations = 0;
+    _aborted = 0;
+    _cache_hits = 0;
+    _steps = 0;
+
+    std::array<double, 3> p = _config.initial;
+    std::array<double, 3> dp = _config.step;
+
+    // 0. Candidates only matter if they beat best_err, so that is their bound
+    double best_err = std::numeric_limits<double>::infinity();
+    auto cost = [this, &p, &best_err]() { return evaluate({p[0], p[1], p[2]}, best_err); };
+
+    best_err = cost();
+    int iteration = 0;
+
+    while (dp[0] + dp[1] + dp[2] > _config.threshold && iteration < _config.max_iterations)
+    {
+        for (std::size_t i = 0; i < p.size(); i++)
+        {
+            // 1. Try a step up
+            p[i] = std::max(p[i] + dp[i], 0.0);
+            double err = cost();
+
+            if (err < best_err)
+            {
+                best_err = err;
+                dp[i] *= 1.1;
+            }
+            else
+            {
+                // 2. Try a step down instead
+                p[i] = std::max(p[i] - 2 * dp[i], 0.0);
+                err = cost();
+
+                if (err < best_err)
+                {
+                    best_err = err;
+                    dp[i] *= 1.1;
+                }
+                else
+                {
+                    // 3. Neither helped: go back and shrink the step
+                    p[i] += dp[i];
+                    dp[i] *= 0.9;
+                }
+            }
+            iteration++;
+        }
+    }
+
+    TuningResult result{{p[0], p[1], p[2]}, best_err, _evaluations};
+    result.aborted = _aborted;
+    result.cache_hits = _cache_hits;
+    return result;
+}
@@ -0,0 +1,133 @@
+#include "UdpTelemetry.hpp"
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+    const char kPacketMagic[4] = {'A', 'T', 'L', 'P'};
+    const std::size_t kRecordSize = 4 * sizeof(double);
+}
+
+UdpTelemetryPublisher::UdpTelemetryPublisher(const std::string &host, std::uint16_t port, unsigned decimation)
+    : _socket(-1), _address_length(0), _decimation(decimation ? decimation : 1), _counter(0), _sequence(0),
+      _pending(0), _stats{0, 0, 0}
+{
+    // The packet header carries the factor as uint16
+    if (_decimation > std::numeric_limits<std::uint16_t>::max())
+        throw std::invalid_argument("Telemetry decimation must be at most 65535");
+
+    // 1. Resolve the destination
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo *result = nullptr;
+    const std::string service = std::to_string(port);
+    if (getaddrinfo(host.c_str(), service.c_str(), &hints, &result) != 0 || !result)
+        throw std::runtime_error("Cannot resolve telemetry address " + host);
+
+    static_assert(sizeof(_address) >= sizeof(sockaddr_storage), "Address buffer too small");
+    std::memcpy(_address, result->ai_addr, result->ai_addrlen);
+    _address_length = static_cast<unsigned>(result->ai_addrlen);
+    const int family = result->ai_family;
+    freeaddrinfo(result);
+
+    // 2. Open the socket
+    _socket = socket(family, SOCK_DGRAM, 0);
+    if (_socket < 0)
+        throw std::runtime_error("Cannot open telemetry socket");
+
+    // 3. Multicast: stay on the local network and loop back to local listeners
+    const sockaddr *addr = reinterpret_cast<const sockaddr *>(_address);
+    if (addr->sa_family == AF_INET)
+    {
+        std::uint32_t ip = ntohl(reinterpret_cast<const sockaddr_in *>(addr)->sin_addr.s_addr);
+        if ((ip >> 28) == 0xE)
+        {
+            unsigned char ttl = 1, loop = 1;
+            setsockopt(_socket, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+            setsockopt(_socket, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+        }
+    }
+}
+
+UdpTelemetryPublisher::~UdpTelemetryPublisher()
+{
+    close();
+}
+
+void UdpTelemetryPublisher::write(const TelemetryRecord &record)
+{
+    if (_socket < 0 || (_counter++ % _decimation) != 0)
+        return;
+
+    _records[_pending++] = record;
+    _stats.records++;
+    if (_pending == kRecordsPerPacket)
+        sendPacket(0);
+}
+
+void UdpTelemetryPublisher::close()
+{
+    if (_socket < 0)
+        return;
+    sendPacket(kFlagLast);
+    ::close(_socket);
+    _socket = -1;
+}
+
+void UdpTelemetryPublisher::sendPacket(std::uint16_t flags)
+{
+    unsigned char packet[sizeof(TelemetryPacketHeader) + kRecordsPerPacket * kRecordSize];
+
+    TelemetryPacketHeader header;
+    std::memcpy(header.magic, kPacketMagic, sizeof(kPacketMagic));
+    header.version = kVersion;
+    header.count = static_cast<std::uint16_t>(_pending);
+    header.sequence = _sequence++;
+    header.flags = flags;
+    header.decimation = static_cast<std::uint16_t>(_decimation);
+    std::memcpy(packet, &header, sizeof(header));
+
+    unsigned char *cursor = packet + sizeof(header);
+    for (std::size_t i = 0; i < _pending; i++)
+    {
+        const double values[4] = {_records[i].time, _records[i].target, _records[i].actual, _records[i].output};
+        std::memcpy(cursor, values, kRecordSize);
+        cursor += kRecordSize;
+    }
+    _pending = 0;
+
+    // MSG_DONTWAIT: a full socket buffer costs a packet, never a deadline
+    ssize_t sent = sendto(_socket, packet, static_cast<std::size_t>(cursor - packet), MSG_DONTWAIT,
+                          reinterpret_cast<const sockaddr *>(_address), _address_length);
+    if (sent < 0)
+        _stats.send_errors++;
+    else
+        _stats.packets++;
+}
+
+bool parseHostPort(const std::string &text, std::string &host, std::uint16_t &port)
+{
+    std::size_t colon = text.rfind(':');
+    if (colon == std::string::npos || colon == 0 || colon + 1 == text.size())
+        return false;
+    try
+    {
+        unsigned long value = std::stoul(text.substr(colon + 1));
+        if (value == 0 || value > 65535)
+            return false;
+        port = static_cast<std::uint16_t>(value);
+    }
+    catch (...)
+    {
+        return false;
+    }
+    host = text.substr(0, colon);
+    return true;
+}
@@ -1,19 +1,275 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 #include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
+#include "Instrumentation.hpp"
 #include "PID.hpp"
+#include "Plant.hpp"
+#include "RealTimeScheduler.hpp"
+#include "ReplaySensor.hpp"
+#include "Scenario.hpp"
+#include "SimulationServer.hpp"
 #include "MockSensor.hpp"
+#include "MonteCarlo.hpp"
+#include "Optimizers.hpp"
+#include "PrecisionCompare.hpp"
+#include "Metrics.hpp"
+#include "Sweep.hpp"
+#include "SwarmSimulation.hpp"
+#include "Telemetry.hpp"
+#include "TelemetryDownsampler.hpp"
+#include "TelemetrySink.hpp"
+#include "ThreadPool.hpp"
+#include "Tuner.hpp"
+#include "UdpTelemetry.hpp"
 
-int main(int argc, char *argv[])
+// Optional "--name" / "--name=value" arguments. They are pulled out of argv
+// first, so every mode keeps its positional arguments unchanged.
+struct Flags
+{
+    std::map<std::string, std::string> values;
+
+    bool has(const std::string &name) const { return values.count(name) > 0; }
+    std::string get(const std::string &name, const std::string &fallback) const
+    {
+        auto it = values.find(name);
+        return (it == values.end()) ? fallback : it->second;
+    }
+
+    // Numeric flag: fallback when absent, or (with a message) when it does not parse
+    template <typename T>
+    T number(const std::string &name, T fallback) const
+    {
+        auto it = values.find(name);
+        if (it == values.end())
+            return fallback;
+
+        std::istringstream in(it->second);
+        T value;
+        bool negative = std::is_unsigned<T>::value && it->second.find('-') != std::string::npos;
+        if (!negative && (in >> value) && (in >> std::ws).eof())
+            return value;
+        std::cerr << "Invalid --" << name << "='" << it->second << "'. Using " << fallback << "." << std::endl;
+        return fallback;
+    }
+};
+
+static Flags extractFlags(int &argc, char *argv[])
+{
+    Flags flags;
+    int kept = 0;
+    for (int i = 0; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i > 0 && arg.rfind("--", 0) == 0)
+        {
+            std::size_t eq = arg.find('=');
+            if (eq == std::string::npos)
+                flags.values[arg.substr(2)] = "";
+            else
+                flags.values[arg.substr(2, eq - 2)] = arg.substr(eq + 1);
+            continue;
+        }
+        argv[kept++] = argv[i];
+    }
+    argc = kept;
+    return flags;
+}
+
+// --plant=integrator|vehicle and --integrator=rk4|euler (what the motor command drives).
+// --physics-rate=Hz runs the plant at that rate, rounded to whole substeps of mission.dt.
+static void applyPlantFlags(const Flags &flags, MissionProfile &mission)
+{
+    if (flags.has("plant") && !parsePlantType(flags.get("plant", ""), mission.plant.type))
+        std::cerr << "Unknown plant '" << flags.get("plant", "") << "'. Using integrator." << std::endl;
+    if (flags.has("integrator") && !parseIntegratorMethod(flags.get("integrator", ""), mission.plant.integrator))
+        std::cerr << "Unknown integrator '" << flags.get("integrator", "") << "'. Using rk4." << std::endl;
+    if (flags.has("physics-rate"))
+    {
+        const double current = mission.plant.substeps / mission.dt; // Hz
+        double rate = flags.number<double>("physics-rate", current);
+        if (!(std::isfinite(rate) && rate > 0.0))
+        {
+            std::cerr << "Invalid --physics-rate='" << flags.get("physics-rate", "") << "': must be positive. Using "
+                      << current << "." << std::endl;
+            rate = current;
+        }
+        mission.plant.substeps = std::max(1, static_cast<int>(std::lround(rate * mission.dt)));
+    }
+}
+
+// --d-filter=SECONDS, --d-on-measurement, --anti-windup=none|conditional|back-calculation [--aw-gain=K]
+static void applyPIDFlags(const Flags &flags, MissionProfile &mission)
+{
+    PIDOptions &options = mission.pid;
+    options.derivative_filter = flags.number<double>("d-filter", 0.0);
+    if (!(options.derivative_filter >= 0.0)) // A time constant; negative would make the filter unstable
+    {
+        std::cerr << "Invalid --d-filter='" << flags.get("d-filter", "") << "': must not be negative. Using 0." << std::endl;
+        options.derivative_filter = 0.0;
+    }
+    options.derivative_on_measurement = flags.has("d-on-measurement");
+    options.back_calculation_gain = flags.number<double>("aw-gain", 0.0);
+
+    std::string mode = flags.get("anti-windup", "none");
+    if (mode == "conditional")
+        options.anti_windup = AntiWindup::Conditional;
+    else if (mode == "back-calculation")
+        options.anti_windup = AntiWindup::BackCalculation;
+    else if (mode != "none")
+        std::cerr << "Unknown anti-windup '" << mode << "'. Using none." << std::endl;
+}
+
+// --format=csv (default), bin64 or bin32
+static std::unique_ptr<TelemetryWriter> makeFileWriter(const Flags &flags, const MissionProfile &mission)
+{
+    std::string format = flags.get("format", "csv");
+    if (format == "bin64" || format == "bin")
+        return std::make_unique<BinaryTelemetryWriter>("telemetry.bin", mission.dt, mission.steps, TelemetryPrecision::Float64);
+    if (format == "bin32")
+        return std::make_unique<BinaryTelemetryWriter>("telemetry.bin", mission.dt, mission.steps, TelemetryPrecision::Float32);
+    if (format != "csv")
+        std::cerr << "Unknown telemetry format '" << format << "'. Using csv." << std::endl;
+    return std::make_unique<CsvTelemetryWriter>("telemetry.csv");
+}
+
+// --max-points=N caps the file at N plot-ready points (--downsample=minmax|decimate)
+static std::unique_ptr<TelemetryWriter> makeDownsampledWriter(const Flags &flags, const MissionProfile &mission)
+{
+    std::unique_ptr<TelemetryWriter> writer = makeFileWriter(flags, mission);
+    if (!flags.has("max-points"))
+        return writer;
+
+    DownsampleMode mode = (flags.get("downsample", "minmax") == "decimate") ? DownsampleMode::Decimate : DownsampleMode::MinMax;
+    std::size_t max_points = flags.number<std::size_t>("max-points", 0);
+    return std::make_unique<DownsamplingTelemetryWriter>(std::move(writer), mission.steps, max_points, mode);
+}
+
+// --async moves file I/O to a background thread (--async-policy=block|drop, --async-capacity=N)
+static std::unique_ptr<TelemetryWriter> makeTelemetryWriter(const Flags &flags, const MissionProfile &mission)
+{
+    std::unique_ptr<TelemetryWriter> writer = makeDownsampledWriter(flags, mission);
+    if (!flags.has("async"))
+        return writer;
+
+    OverflowPolicy policy = (flags.get("async-policy", "block") == "drop") ? OverflowPolicy::Drop : OverflowPolicy::Block;
+    std::size_t capacity = flags.number<std::size_t>("async-capacity", 16384);
+    return std::make_unique<TelemetrySink>(std::move(writer), capacity, policy);
+}
+
+// Usage: flight_controller tune <steps> <target1> <target2> <switch_step> <accuracy|balanced>
+//                               [--method=twiddle|nelder-mead|de|cmaes] [--evaluations=N] [--threads=N] [--cache-dir=DIR]
+//                               [--plant=integrator|vehicle] [--integrator=rk4|euler] [--physics-rate=Hz]
+//                               [--d-filter=SECONDS] [--d-on-measurement] [--anti-windup=none|conditional|back-calculation [--aw-gain=K]]
+// Prints only the tuned gains and their cost as a one-row CSV.
+static int runTune(int argc, char *argv[], const Flags &flags)
+{
+    MissionProfile mission;
+    OptimizerConfig config;
+    config.method = OptimizerMethod::Twiddle;
+
+    if (argc >= 6)
+    {
+        try
+        {
+            mission.steps = std::stoi(argv[2]);
+            mission.target1 = std::stod(argv[3]);
+            mission.target2 = std::stod(argv[4]);
+            mission.switch_step = std::stoi(argv[5]);
+        }
+        catch (...)
+        {
+            std::cerr << "Invalid arguments. Using defaults." << std::endl;
+        }
+    }
+    if (argc >= 7 && std::string(argv[6]) == "balanced")
+        config.strategy = TuningStrategy::Balanced;
+    applyPlantFlags(flags, mission);
+    applyPIDFlags(flags, mission);
+
+    if (!parseOptimizerMethod(flags.get("method", "twiddle"), config.method))
+        std::cerr << "Unknown method '" << flags.get("method", "") << "'. Using twiddle." << std::endl;
+    config.max_evaluations = flags.number<int>("evaluations", config.max_evaluations);
+    config.threads = flags.number<unsigned>("threads", 1);
+    ResultCache cache(4096, flags.get("cache-dir", ""));
+    config.cache = &cache;
+
+    TuningResult result = optimizeGains(mission, config);
+
+    std::cout << std::setprecision(10);
+    std::cout << "Kp,Ki,Kd,Cost\n";
+    std::cout << result.gains.kp << "," << result.gains.ki << "," << result.gains.kd << "," << result.cost << std::endl;
+    return 0;
+}
+
+// Usage: flight_controller sweep <kp_min> <kp_max> <kp_n> <ki_min> <ki_max> <ki_n> <kd_min> <kd_max> <kd_n>
+//                                <steps> <target1> <target2> <switch_step> [accuracy|balanced] [threads]
+//                                [--plant=integrator|vehicle] [--integrator=rk4|euler] [--physics-rate=Hz]
+//                                [--d-filter=SECONDS] [--d-on-measurement] [--anti-windup=none|conditional|back-calculation [--aw-gain=K]]
+// Prints the ranked result table (best first) as CSV. Nothing is written to disk.
+static int runSweepMode(int argc, char *argv[], const Flags &flags)
+{
+    MissionProfile mission;
+    SweepConfig config;
+
+    if (argc >= 15)
+    {
+        try
+        {
+            config.kp = {std::stod(argv[2]), std::stod(argv[3]), std::stoi(argv[4])};
+            config.ki = {std::stod(argv[5]), std::stod(argv[6]), std::stoi(argv[7])};
+            config.kd = {std::stod(argv[8]), std::stod(argv[9]), std::stoi(argv[10])};
+            mission.steps = std::stoi(argv[11]);
+            mission.target1 = std::stod(argv[12]);
+            mission.target2 = std::stod(argv[13]);
+            mission.switch_step = std::stoi(argv[14]);
+            if (argc >= 17)
+                config.threads = std::stoul(argv[16]);
+        }
+        catch (...)
+        {
+            std::cerr << "Invalid arguments. Using defaults." << std::endl;
+        }
+    }
+    if (argc >= 16 && std::string(argv[15]) == "balanced")
+        config.strategy = TuningStrategy::Balanced;
+    applyPlantFlags(flags, mission);
+    applyPIDFlags(flags, mission);
+
+    std::vector<SweepResult> results = runSweep(mission, config);
+
+    std::cout << std::setprecision(10);
+    std::cout << "Rank,Kp,Ki,Kd,Cost,RMSE,Overshoot,SettlingTime\n";
+    for (std::size_t r = 0; r < results.size(); r++)
+    {
+        const SweepResult &res = results[r];
+        std::cout << r + 1 << "," << res.gains.kp << "," << res.gains.ki << "," << res.gains.kd << "," << res.cost << ","
+                  << res.metrics.rmse << "," << res.metrics.overshoot_percent << "," << res.metrics.settling_time << "\n";
+    }
+    return 0;
+}
+
+// Usage: flight_controller <Kp> <Ki> <Kd> <steps> <target1> <target2> <switch_step> [seed] [--format=csv|bin64|bin32] [--async]
+//                          [--max-points=N [--downsample=minmax|decimate]]
+//                          [--realtime [--rate=Hz] [--cpu=N] [--fifo]] [--udp=host:port [--decimate=N]]
+//                          [--plant=integrator|vehicle] [--integrator=rk4|euler] [--physics-rate=Hz]
+//                          [--d-filter=SECONDS] [--d-on-measurement] [--anti-windup=none|conditional|back-calculation [--aw-gain=K]]
+static int runMission(int argc, char *argv[], const Flags &flags)
 {
     // 1. Defaults
     double Kp = 0.6, Ki = 0.01, Kd = 0.05;
-    int steps = 1000;
-    double target1 = 50.0;  // Start here
-    double target2 = 100.0; // Move here later
-    int switch_step = 500;  // When to switch
+    MissionProfile mission; // 1000 steps, 50m -> 100m at step 500
 
-    // 2. Parse Arguments (Now expecting up to 7 args)
+    // 2. Parse Arguments (7 args, plus an optional noise seed)
     if (argc >= 8)
     {
         try
@@ -21,10 +277,12 @@ int main(int argc, char *argv[])
             Kp = std::stod(argv[1]);
             Ki = std::stod(argv[2]);
             Kd = std::stod(argv[3]);
-            steps = std::stoi(argv[4]);
-            target1 = std::stod(argv[5]);
-            target2 = std::stod(argv[6]);
-            switch_step = std::stoi(argv[7]);
+            mission.steps = std::stoi(argv[4]);
+            mission.target1 = std::stod(argv[5]);
+            mission.target2 = std::stod(argv[6]);
+            mission.switch_step = std::stoi(argv[7]);
+            if (argc >= 9)
+                mission.noise.seed = std::stoull(argv[8]);
         }
         catch (...)
         {
@@ -32,29 +290,455 @@ int main(int argc, char *argv[])
         }
     }
 
+    // Real-time (HIL) mode: fixed-rate loop with deadline tracking
+    const bool realtime = flags.has("realtime");
+    RealTimeConfig rt_config;
+    rt_config.rate_hz = flags.number<double>("rate", 1000.0);
+    rt_config.cpu = flags.number<int>("cpu", -1);
+    rt_config.fifo = flags.has("fifo");
+    if (realtime && !(std::isfinite(rt_config.rate_hz) && rt_config.rate_hz > 0.0))
+    {
+        // The period (and so mission.dt) is 1 / rate
+        std::cerr << "Invalid --rate: must be a positive number of Hz." << std::endl;
+        return 1;
+    }
+    RealTimeScheduler scheduler(rt_config);
+    if (realtime)
+    {
+        mission.dt = scheduler.period();
+        std::string error;
+        if (!scheduler.applyThreadSettings(error))
+            std::cerr << "[RealTime] " << error << "Continuing without it." << std::endl;
+    }
+    applyPlantFlags(flags, mission); // After --rate, which sets dt
+    applyPIDFlags(flags, mission);
+
     // 3. Setup
-    std::ofstream logFile("telemetry.csv");
-    logFile << "Time,Target,Actual,Output\n";
+    std::unique_ptr<TelemetryWriter> telemetry = makeTelemetryWriter(flags, mission);
+    TelemetrySink *sink = dynamic_cast<TelemetrySink *>(telemetry.get());
+
+    // Live view: --udp=host:port also publishes every --decimate-th record
+    UdpTelemetryPublisher *udp = nullptr;
+    if (flags.has("udp"))
+    {
+        std::string host;
+        std::uint16_t port = 0;
+        try
+        {
+            if (!parseHostPort(flags.get("udp", ""), host, port))
+                throw std::runtime_error("Expected --udp=host:port");
+            auto publisher = std::make_unique<UdpTelemetryPublisher>(host, port, flags.number<unsigned>("decimate", 1));
+            udp = publisher.get();
+            telemetry = std::make_unique<TeeTelemetryWriter>(std::move(telemetry), std::move(publisher));
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "[UdpTelemetry] " << e.what() << ". Continuing without it." << std::endl;
+        }
+    }
 
-    double dt = 0.1;
-    PID pid(Kp, Ki, Kd, dt, 500.0, -500.0);
+    double dt = mission.dt;
+    PID pid(Kp, Ki, Kd, dt, mission.max_output, mission.min_output, mission.pid);
 
-    MockSensor altimeter(0.0);
+    MockSensor altimeter(mission.initial_altitude, mission.noise);
     altimeter.init();
+    std::unique_ptr<Plant> plant = makePlant(mission.plant, mission.initial_altitude);
+
+    Metrics metrics(mission);
+    LoopProfiler profiler; // Only filled when built with AEROSTREAM_ENABLE_INSTRUMENTATION
 
     // 4. Run Loop
-    for (int i = 0; i < steps; i++)
+    if (realtime)
+        scheduler.start();
+    for (int i = 0; i < mission.steps; i++)
     {
+        if (realtime)
+            scheduler.waitNextTick();
+
+        AEROSTREAM_SCOPED_TIMER(profiler.stage(LoopStage::Tick));
+
         // DYNAMIC TARGET LOGIC
-        double current_target = (i < switch_step) ? target1 : target2;
+        double current_target = mission.targetAt(i);
+
+        double current_alt, motor_power;
+        {
+            AEROSTREAM_SCOPED_TIMER(profiler.stage(LoopStage::SensorRead));
+            current_alt = altimeter.readValue();
+        }
+        {
+            AEROSTREAM_SCOPED_TIMER(profiler.stage(LoopStage::Controller));
+            motor_power = pid.calculate(current_target, current_alt);
+        }
+        {
+            AEROSTREAM_SCOPED_TIMER(profiler.stage(LoopStage::Physics));
+            plant->step(motor_power, dt);
+            altimeter.setValue(plant->altitude());
+        }
+
+        metrics.update(i, current_target, current_alt);
+        {
+            AEROSTREAM_SCOPED_TIMER(profiler.stage(LoopStage::Telemetry));
+            telemetry->write({i * dt, current_target, current_alt, motor_power});
+        }
+    }
+
+    telemetry->close();
+    if (sink)
+    {
+        TelemetrySinkStats stats = sink->stats();
+        std::cout << "[TelemetrySink] written=" << stats.written << " dropped=" << stats.dropped
+                  << " stalls=" << stats.stalls << " high_water=" << stats.high_water << std::endl;
+    }
+    if (udp)
+    {
+        const UdpPublisherStats &stats = udp->stats();
+        std::cout << "[UdpTelemetry] records=" << stats.records << " packets=" << stats.packets
+                  << " send_errors=" << stats.send_errors << std::endl;
+    }
+
+    // 5. Summary record for the dashboard (no need to re-scan the telemetry)
+    std::ofstream summaryFile("metrics.csv");
+    writeSummaryCsv(summaryFile, metrics.summary());
+
+#ifdef AEROSTREAM_ENABLE_INSTRUMENTATION
+    std::ofstream latencyFile("latency.json");
+    profiler.writeJson(latencyFile);
+#endif
+
+    if (realtime)
+    {
+        const RealTimeStats &stats = scheduler.stats();
+        std::ofstream rtFile("realtime.csv");
+        writeRealTimeSummaryCsv(rtFile, rt_config, stats);
+        std::ofstream histFile("realtime_latency.csv");
+        stats.wakeup_latency.writeCsv(histFile);
+
+        std::cout << "[RealTime] " << stats.ticks << " ticks at " << rt_config.rate_hz << " Hz, "
+                  << stats.deadline_misses << " deadline misses, wake-up latency p99 "
+                  << stats.wakeup_latency.percentile(0.99) / 1000.0 << " us" << std::endl;
+    }
+    return 0;
+}
+
+// Usage: flight_controller montecarlo <steps> <target1> <target2> <switch_step> <Kp> <Ki> <Kd> [<Kp> <Ki> <Kd> ...]
+//                                     [--samples=K] [--seed=N] [--independent] [--perturb=FRACTION] [--noise-spread=FRACTION]
+//                                     [--threads=N]
+//                                     [--plant=integrator|vehicle] [--integrator=rk4|euler] [--physics-rate=Hz]
+//                                     [--d-filter=SECONDS] [--d-on-measurement] [--anti-windup=none|conditional|back-calculation [--aw-gain=K]]
+// Flies every gain triple over K noise seeds and perturbed vehicles (common random
+// numbers unless --independent) and prints one statistics row per candidate.
+static int runMonteCarloMode(int argc, char *argv[], const Flags &flags)
+{
+    MissionProfile mission;
+    MonteCarloConfig config;
+    std::vector<PIDGains> candidates;
+
+    try
+    {
+        if (argc >= 6)
+        {
+            mission.steps = std::stoi(argv[2]);
+            mission.target1 = std::stod(argv[3]);
+            mission.target2 = std::stod(argv[4]);
+            mission.switch_step = std::stoi(argv[5]);
+        }
+        for (int i = 6; i + 2 < argc; i += 3)
+            candidates.push_back({std::stod(argv[i]), std::stod(argv[i + 1]), std::stod(argv[i + 2])});
+    }
+    catch (...)
+    {
+        std::cerr << "Invalid arguments. Using defaults." << std::endl;
+        candidates.clear();
+    }
+    if (candidates.empty())
+        candidates.push_back({0.6, 0.01, 0.05});
+
+    config.samples = flags.number<int>("samples", 32);
+    config.seed = flags.number<std::uint64_t>("seed", 1);
+    config.common_random_numbers = !flags.has("independent");
+    config.threads = flags.number<std::size_t>("threads", 0);
+    double spread = flags.number<double>("perturb", 0.0);
+    config.perturbation = {spread, spread, spread, spread, flags.number<double>("noise-spread", 0.0)};
+    if (config.samples < 1)
+    {
+        std::cerr << "Samples must be positive." << std::endl;
+        return 1;
+    }
+    if (!(spread >= 0.0 && spread < 1.0) || !(config.perturbation.noise >= 0.0 && config.perturbation.noise < 1.0))
+    {
+        // A spread of 1 or more can draw a zero or negative mass, drag or time constant
+        std::cerr << "Perturbation spreads must be in [0, 1)." << std::endl;
+        return 1;
+    }
+    applyPlantFlags(flags, mission);
+    applyPIDFlags(flags, mission);
+
+    std::vector<MonteCarloResult> results = runMonteCarlo(candidates, mission, config);
+
+    std::cout << std::setprecision(10);
+    std::cout << "Candidate,Kp,Ki,Kd,Samples,RMSEMean,RMSEVar,RMSEWorst,OvershootMean,OvershootVar,OvershootWorst,"
+                 "SettlingMean,SettlingVar,SettlingWorst,Unsettled,RMSEDeltaMean,RMSEDeltaVar\n";
+    for (std::size_t c = 0; c < results.size(); c++)
+    {
+        const MonteCarloResult &r = results[c];
+        std::cout << c << "," << r.gains.kp << "," << r.gains.ki << "," << r.gains.kd << "," << config.samples << ","
+                  << r.rmse.mean << "," << r.rmse.variance << "," << r.rmse.worst << ","
+                  << r.overshoot_percent.mean << "," << r.overshoot_percent.variance << "," << r.overshoot_percent.worst << ","
+                  << r.settling_time.mean << "," << r.settling_time.variance << "," << r.settling_time.worst << ","
+                  << r.unsettled << "," << r.rmse_delta.mean << "," << r.rmse_delta.variance << "\n";
+    }
+    return 0;
+}
+
+// Usage: flight_controller precision <Kp> <Ki> <Kd> <steps> <target1> <target2> <switch_step>
+//                                    [--repeats=N] [--tolerance=METERS]
+//                                    [--plant=integrator|vehicle] [--integrator=rk4|euler] [--physics-rate=Hz]
+// Flies the mission with the controller in double, float and Q-format fixed point and
+// prints each one's metrics, divergence from PID, controller ns/step and whether its
+// altitude stayed within the tolerance of PID's.
+static int runPrecision(int argc, char *argv[], const Flags &flags)
+{
+    PIDGains gains = {0.6, 0.01, 0.05};
+    MissionProfile mission;
+
+    if (argc >= 9)
+    {
+        try
+        {
+            gains = {std::stod(argv[2]), std::stod(argv[3]), std::stod(argv[4])};
+            mission.steps = std::stoi(argv[5]);
+            mission.target1 = std::stod(argv[6]);
+            mission.target2 = std::stod(argv[7]);
+            mission.switch_step = std::stoi(argv[8]);
+        }
+        catch (...)
+        {
+            std::cerr << "Invalid arguments. Using defaults." << std::endl;
+        }
+    }
+    if (mission.steps <= 0)
+    {
+        std::cerr << "Steps must be positive." << std::endl;
+        return 1;
+    }
+    applyPlantFlags(flags, mission);
+    const int repeats = flags.number<int>("repeats", 20);
+    const double tolerance = flags.number<double>("tolerance", 0.1);
+
+    std::vector<PrecisionReport> reports = comparePrecision(gains, mission, repeats);
+
+    std::cout << std::setprecision(10);
+    std::cout << "Type,RMSE,Overshoot,SettlingTime,MaxAltitudeError,MaxOutputError,NsPerStep,WithinTolerance\n";
+    for (const PrecisionReport &r : reports)
+    {
+        std::cout << numericTypeName(r.type) << "," << r.metrics.rmse << "," << r.metrics.overshoot_percent << ","
+                  << r.metrics.settling_time << "," << r.max_altitude_error << "," << r.max_output_error << ","
+                  << r.ns_per_step << "," << (r.max_altitude_error <= tolerance ? 1 : 0) << "\n";
+    }
+    return 0;
+}
+
+// Usage: flight_controller replay <telemetry.csv|telemetry.bin> <Kp> <Ki> <Kd> [--tolerance=X]
+//                                 [--d-filter=SECONDS] [--d-on-measurement] [--anti-windup=none|conditional|back-calculation [--aw-gain=K]]
+// Feeds a recorded flight (memory-mapped, see ReplaySensor.hpp) through PID at the
+// recording's dt and prints how far its commands are from the recorded Output.
+static int runReplay(int argc, char *argv[], const Flags &flags)
+{
+    if (argc < 6)
+    {
+        std::cerr << "Usage: flight_controller replay <file> <Kp> <Ki> <Kd>" << std::endl;
+        return 1;
+    }
+
+    MissionProfile mission;
+    PIDGains gains = {0.6, 0.01, 0.05};
+    try
+    {
+        gains = {std::stod(argv[3]), std::stod(argv[4]), std::stod(argv[5])};
+    }
+    catch (...)
+    {
+        std::cerr << "Invalid arguments. Using defaults." << std::endl;
+    }
+    applyPIDFlags(flags, mission);
+    const double tolerance = flags.number<double>("tolerance", 0.0);
+
+    std::unique_ptr<ReplaySensor> sensor;
+    try
+    {
+        sensor = std::make_unique<ReplaySensor>(argv[2]);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "[Replay] " << e.what() << std::endl;
+        return 1;
+    }
+
+    const double dt = (sensor->dt() > 0.0) ? sensor->dt() : mission.dt;
+    PID pid(gains.kp, gains.ki, gains.kd, dt, mission.max_output, mission.min_output, mission.pid);
+
+    ReplayReport report;
+    auto start = std::chrono::steady_clock::now();
+    try
+    {
+        report = replayController(pid, *sensor, tolerance);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "[Replay] " << e.what() << std::endl;
+        return 1;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::setprecision(10);
+    std::cout << "Samples,MaxError,RMSError,Mismatches,SamplesPerSecond\n";
+    std::cout << report.samples << "," << report.max_error << "," << report.rms_error << "," << report.mismatches << ","
+              << ((seconds > 0.0) ? report.samples / seconds : 0.0) << std::endl;
+    return (report.mismatches == 0) ? 0 : 2;
+}
+
+// Usage: flight_controller swarm <vehicles> <axes> <Kp> <Ki> <Kd> <steps> <target1> <target2> <switch_step>
+//                                [--threads=N] [--telemetry]
+//                                [--plant=integrator|vehicle] [--integrator=rk4|euler] [--physics-rate=Hz]
+//                                [--d-filter=SECONDS] [--d-on-measurement] [--anti-windup=none|conditional|back-calculation [--aw-gain=K]]
+// Prints one metrics row per vehicle axis; --telemetry also writes swarm_telemetry.csv.
+static int runSwarm(int argc, char *argv[], const Flags &flags)
+{
+    SwarmConfig config;
+
+    if (argc >= 11)
+    {
+        try
+        {
+            config.vehicles = std::stoi(argv[2]);
+            config.axes = std::stoi(argv[3]);
+            config.gains = {std::stod(argv[4]), std::stod(argv[5]), std::stod(argv[6])};
+            config.mission.steps = std::stoi(argv[7]);
+            config.mission.target1 = std::stod(argv[8]);
+            config.mission.target2 = std::stod(argv[9]);
+            config.mission.switch_step = std::stoi(argv[10]);
+        }
+        catch (...)
+        {
+            std::cerr << "Invalid arguments. Using defaults." << std::endl;
+        }
+    }
+    if (config.vehicles <= 0 || config.axes <= 0)
+    {
+        std::cerr << "Vehicles and axes must be positive." << std::endl;
+        return 1;
+    }
+    config.threads = flags.number<std::size_t>("threads", 0);
+    config.record = flags.has("telemetry");
+    applyPlantFlags(flags, config.mission);
+    applyPIDFlags(flags, config.mission);
+
+    SwarmSimulation swarm(config);
+    swarm.run();
+
+    std::cout << std::setprecision(10);
+    std::cout << "Vehicle,Axis,RMSE,Overshoot,SettlingTime\n";
+    for (int v = 0; v < config.vehicles; v++)
+    {
+        for (int a = 0; a < config.axes; a++)
+        {
+            const MetricsSummary &m = swarm.metrics()[swarm.lane(v, a)];
+            std::cout << v << "," << a << "," << m.rmse << "," << m.overshoot_percent << "," << m.settling_time << "\n";
+        }
+    }
+
+    if (config.record)
+        swarm.writeTelemetryCsv("swarm_telemetry.csv");
+    return 0;
+}
+
+// Usage: flight_controller scenario <file> <Kp> <Ki> <Kd> [--threads=N] [--telemetry]
+// Flies every scenario in the file (see Scenario.hpp) and prints one metrics row
+// per scenario; --telemetry also writes scenario_<name>.csv for each (the parser
+// only accepts unique names of letters, digits, '_' and '-', so files stay in
+// the working directory and no two threads share one).
+static int runScenarios(int argc, char *argv[], const Flags &flags)
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: flight_controller scenario <file> <Kp> <Ki> <Kd>" << std::endl;
+        return 1;
+    }
 
-        double current_alt = altimeter.readValue();
-        double motor_power = pid.calculate(current_target, current_alt);
-        altimeter.update(motor_power * dt);
+    PIDGains gains = {0.6, 0.01, 0.05};
+    if (argc >= 6)
+    {
+        try
+        {
+            gains = {std::stod(argv[3]), std::stod(argv[4]), std::stod(argv[5])};
+        }
+        catch (...)
+        {
+            std::cerr << "Invalid arguments. Using defaults." << std::endl;
+        }
+    }
 
-        logFile << i * dt << "," << current_target << "," << current_alt << "," << motor_power << "\n";
+    std::vector<Scenario> scenarios;
+    try
+    {
+        scenarios = loadScenarios(argv[2]);
     }
+    catch (const std::exception &e)
+    {
+        std::cerr << "[Scenario] " << e.what() << std::endl;
+        return 1;
+    }
+
+    // Scenarios are independent, so they can fly side by side
+    const bool record = flags.has("telemetry");
+    std::vector<MetricsSummary> results(scenarios.size());
+    ThreadPool pool(flags.number<std::size_t>("threads", 1));
+    pool.parallelFor(scenarios.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t s = begin; s < end; s++)
+        {
+            std::unique_ptr<TelemetryWriter> telemetry;
+            if (record)
+                telemetry = std::make_unique<CsvTelemetryWriter>("scenario_" + scenarios[s].name + ".csv");
+            results[s] = runScenario(gains, scenarios[s], telemetry.get());
+        }
+    });
 
-    logFile.close();
+    std::cout << std::setprecision(10);
+    std::cout << "Scenario,Steps,RMSE,Overshoot,SettlingTime,Samples\n";
+    for (std::size_t s = 0; s < scenarios.size(); s++)
+    {
+        const MetricsSummary &m = results[s];
+        std::cout << scenarios[s].name << "," << scenarios[s].setpoint.size() << "," << m.rmse << ","
+                  << m.overshoot_percent << "," << m.settling_time << "," << m.samples << "\n";
+    }
     return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char *argv[])
+{
+    Flags flags = extractFlags(argc, argv);
+
+    if (argc >= 2 && std::string(argv[1]) == "tune")
+        return runTune(argc, argv, flags);
+    if (argc >= 2 && std::string(argv[1]) == "sweep")
+        return runSweepMode(argc, argv, flags);
+    if (argc >= 2 && std::string(argv[1]) == "scenario")
+        return runScenarios(argc, argv, flags);
+    if (argc >= 2 && std::string(argv[1]) == "swarm")
+        return runSwarm(argc, argv, flags);
+    if (argc >= 2 && std::string(argv[1]) == "montecarlo")
+        return runMonteCarloMode(argc, argv, flags);
+    if (argc >= 2 && std::string(argv[1]) == "precision")
+        return runPrecision(argc, argv, flags);
+    if (argc >= 2 && std::string(argv[1]) == "replay")
+        return runReplay(argc, argv, flags);
+    if (argc >= 2 && std::string(argv[1]) == "serve")
+    {
+        // Line protocol on stdin/stdout, see SimulationServer.hpp (--cache-dir=DIR persists metrics)
+        SimulationServer server(flags.get("cache-dir", ""));
+        server.serve(std::cin, std::cout);
+        return 0;
+    }
+
+    return runMission(argc, argv, flags);
+}
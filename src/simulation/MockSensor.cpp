@@ -1,22 +1,67 @@
 #include "MockSensor.hpp"
 #include <iostream>
-#include <cstdlib> // For rand()
 
-MockSensor::MockSensor(double initial_value) : _value(initial_value) {}
+MockSensor::MockSensor(double initial_value) : MockSensor(initial_value, SensorNoise()) {}
+
+MockSensor::MockSensor(double initial_value, const SensorNoise &noise)
+    : _value(initial_value), _noise(noise), _noise_pos(kNoiseBlock), _samples(0), _sample_period(0.1)
+{
+}
 
 void MockSensor::init()
 {
     std::cout << "[MockSensor] Initialized and calibrated." << std::endl;
 }
 
-double MockSensor::readValue()
+void MockSensor::refillNoise()
 {
-    // Simulate sensor noise: +/- 0.5 meters random fluctuation
-    double noise = ((std::rand() % 100) / 100.0) - 0.5;
-    return _value + noise;
+    _noise.fill(_noise_block.data(), kNoiseBlock);
+    _noise_pos = 0;
+}
+
+std::size_t MockSensor::readBatch(double *values, double *timestamps, std::size_t count)
+{
+    std::size_t i = 0;
+
+    // 1. Leftovers of the current block (keeps the stream identical to readValue())
+    while (i < count && _noise_pos < kNoiseBlock)
+        values[i++] = _noise_block[_noise_pos++];
+
+    // 2. Whole blocks straight into the caller's buffer
+    std::size_t whole = ((count - i) / kNoiseBlock) * kNoiseBlock;
+    _noise.fill(values + i, whole);
+    i += whole;
+
+    // 3. Tail from a fresh block
+    while (i < count)
+    {
+        if (_noise_pos == kNoiseBlock)
+            refillNoise();
+        values[i++] = _noise_block[_noise_pos++];
+    }
+
+    for (std::size_t k = 0; k < count; k++)
+    {
+        values[k] += _value;
+        if (timestamps)
+            timestamps[k] = (_samples + k) * _sample_period;
+    }
+    _samples += count;
+    return count;
 }
 
 void MockSensor::update(double step_value)
 {
     _value += step_value;
-}
\ No newline at end of file
+}
+
+void MockSensor::fillNoise(double *out, std::size_t count)
+{
+    _noise.fill(out, count);
+}
+
+void MockSensor::reseed(std::uint64_t seed)
+{
+    _noise.reseed(seed);
+    _noise_pos = kNoiseBlock; // Drop samples generated from the old stream
+}
@@ -0,0 +1,34 @@
+#include "Noise.hpp"
+#include <cmath>
+
+NoiseGenerator::NoiseGenerator(const SensorNoise &config)
+    : _config(config), _rng(config.seed)
+{
+}
+
+void NoiseGenerator::fill(double *out, std::size_t count)
+{
+    const double amplitude = _config.amplitude;
+
+    if (_config.distribution == NoiseDistribution::Uniform)
+    {
+        const double scale = 2.0 * amplitude;
+        for (std::size_t i = 0; i < count; i++)
+            out[i] = _rng.nextDouble() * scale - amplitude;
+        return;
+    }
+
+    // Box-Muller: two independent Gaussian samples per pair of uniforms
+    const double two_pi = 6.283185307179586;
+    std::size_t i = 0;
+    while (i < count)
+    {
+        double u1 = 1.0 - _rng.nextDouble(); // (0, 1], keeps log() finite
+        double u2 = _rng.nextDouble();
+        double radius = amplitude * std::sqrt(-2.0 * std::log(u1));
+
+        out[i++] = radius * std::cos(two_pi * u2);
+        if (i < count)
+            out[i++] = radius * std::sin(two_pi * u2);
+    }
+}
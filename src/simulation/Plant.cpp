@@ -0,0 +1,76 @@
+#include "Plant.hpp"
+
+bool parsePlantType(const std::string &name, PlantType &type)
+{
+    if (name == "integrator")
+        type = PlantType::Integrator;
+    else if (name == "vehicle")
+        type = PlantType::Vehicle;
+    else
+        return false;
+    return true;
+}
+
+bool parseIntegratorMethod(const std::string &name, IntegratorMethod &method)
+{
+    if (name == "euler")
+        method = IntegratorMethod::SemiImplicitEuler;
+    else if (name == "rk4")
+        method = IntegratorMethod::RK4;
+    else
+        return false;
+    return true;
+}
+
+std::unique_ptr<Plant> makePlant(const PlantConfig &config, double altitude)
+{
+    if (config.type == PlantType::Vehicle)
+        return std::make_unique<VehiclePlant>(config, altitude);
+    return std::make_unique<IntegratorPlant>(altitude);
+}
+
+PlantBatch::PlantBatch(std::size_t lanes, const PlantConfig &config, double altitude)
+    : _config(config), _substeps(std::max(config.substeps, 1)), _dt(0.0),
+      _step(plant_detail::vehicleStep(config.vehicle, 0.1)), _altitude(lanes, altitude),
+      _velocity(lanes, 0.0), _thrust(lanes, plant_detail::hoverThrust(config.vehicle))
+{
+}
+
+namespace
+{
+    // Substeps outside, lanes inside: the lane loop is the one that vectorizes,
+    // and the state arrays stay in L1 between substeps
+    template <IntegratorMethod Method>
+    void stepVehicles(const plant_detail::VehicleStep &step, int substeps, const double *command, std::size_t n,
+                      double *z, double *v, double *thrust)
+    {
+        const plant_detail::VehicleStep k = step; // Local copy: the lane stores cannot alias it
+        for (int s = 0; s < substeps; s++)
+            for (std::size_t l = 0; l < n; l++)
+                plant_detail::stepVehicle<Method>(k, command[l], z[l], v[l], thrust[l]);
+    }
+}
+
+void PlantBatch::step(const double *command, double dt)
+{
+    const std::size_t n = _altitude.size();
+    double *z = _altitude.data();
+
+    if (_config.type == PlantType::Integrator)
+    {
+        for (std::size_t l = 0; l < n; l++)
+            z[l] += command[l] * dt;
+        std::copy(command, command + n, _velocity.begin());
+        return;
+    }
+
+    if (dt != _dt)
+    {
+        _step = plant_detail::vehicleStep(_config.vehicle, dt / _substeps);
+        _dt = dt;
+    }
+    if (_config.integrator == IntegratorMethod::RK4)
+        stepVehicles<IntegratorMethod::RK4>(_step, _substeps, command, n, z, _velocity.data(), _thrust.data());
+    else
+        stepVehicles<IntegratorMethod::SemiImplicitEuler>(_step, _substeps, command, n, z, _velocity.data(), _thrust.data());
+}
@@ -0,0 +1,208 @@
+#include "ReplaySensor.hpp"
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// --- MappedFile ---
+
+MappedFile::MappedFile(const std::string &path) : _data(nullptr), _size(0)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open telemetry file: " + path);
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("Cannot stat telemetry file: " + path);
+    }
+    _size = static_cast<std::size_t>(info.st_size);
+
+    // An empty file cannot be mapped; it is simply zero bytes of data
+    if (_size > 0)
+    {
+        void *mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            ::close(fd);
+            throw std::runtime_error("Cannot map telemetry file: " + path);
+        }
+        ::madvise(mapping, _size, MADV_SEQUENTIAL); // Replay reads front to back
+        _data = static_cast<const char *>(mapping);
+    }
+    ::close(fd); // The mapping stays valid
+}
+
+MappedFile::~MappedFile()
+{
+    if (_data)
+        ::munmap(const_cast<char *>(_data), _size);
+}
+
+// --- ReplaySensor ---
+
+namespace
+{
+    const char kCsvHeader[] = "Time,Target,Actual,Output";
+
+    // One CSV field, ending at sep; advances p past the separator
+    bool parseField(const char *&p, const char *end, char sep, double &value)
+    {
+        const char *stop = static_cast<const char *>(std::memchr(p, sep, end - p));
+        if (!stop)
+            stop = end; // Last row without a trailing newline
+        const char *field_end = (stop > p && stop[-1] == '\r') ? stop - 1 : stop;
+        std::from_chars_result result = std::from_chars(p, field_end, value);
+        if (result.ec != std::errc() || result.ptr != field_end)
+            return false;
+        p = (stop == end) ? end : stop + 1;
+        return true;
+    }
+
+    // True if [p, stop) is empty or whitespace only (e.g. a trailing blank line)
+    bool isBlank(const char *p, const char *stop)
+    {
+        for (; p < stop; p++)
+            if (*p != ' ' && *p != '\t' && *p != '\r')
+                return false;
+        return true;
+    }
+
+    // Start of the first non-blank line at or after p, or end
+    const char *skipBlankLines(const char *p, const char *end)
+    {
+        while (p < end)
+        {
+            const char *next = static_cast<const char *>(std::memchr(p, '\n', end - p));
+            if (!isBlank(p, next ? next : end))
+                return p;
+            p = next ? next + 1 : end;
+        }
+        return end;
+    }
+}
+
+ReplaySensor::ReplaySensor(const std::string &path)
+    : _file(path), _format(ReplayFormat::Csv), _steps(0), _pos(0), _dt(0.0), _columns(), _actual(nullptr),
+      _first_row(nullptr), _cursor(nullptr), _record{0.0, 0.0, 0.0, 0.0}
+{
+    const char *data = _file.data();
+    const char *end = data + _file.size();
+
+    // 1. Binary: columns are used in place
+    BinaryTelemetryLayout layout;
+    if (parseBinaryTelemetryHeader(data, _file.size(), layout))
+    {
+        _format = (layout.value_size == 8) ? ReplayFormat::Float64 : ReplayFormat::Float32;
+        _steps = static_cast<std::size_t>(layout.steps);
+        _dt = layout.dt;
+        for (std::size_t c = 0; c < BinaryTelemetryWriter::kColumnCount; c++)
+            _columns[c] = data + layout.header_size + c * _steps * layout.value_size;
+        _actual = reinterpret_cast<const double *>(_columns[2]);
+        return;
+    }
+
+    // 2. CSV: check the header, count non-blank rows (one memchr pass), take dt from the first two
+    const std::size_t header_size = sizeof(kCsvHeader) - 1;
+    if (_file.size() < header_size || std::memcmp(data, kCsvHeader, header_size) != 0)
+        throw std::runtime_error("Not a telemetry file: " + path);
+    const char *newline = static_cast<const char *>(std::memchr(data, '\n', end - data));
+    _first_row = newline ? newline + 1 : end;
+
+    for (const char *p = _first_row; p < end;)
+    {
+        const char *next = static_cast<const char *>(std::memchr(p, '\n', end - p));
+        _steps += isBlank(p, next ? next : end) ? 0 : 1;
+        p = next ? next + 1 : end;
+    }
+
+    _cursor = _first_row;
+    TelemetryRecord first, second;
+    if (_steps > 0 && !parseRow(first))
+        throw std::runtime_error("Malformed telemetry row 1: " + path);
+    if (_steps > 1 && parseRow(second))
+        _dt = second.time - first.time;
+    _cursor = _first_row;
+}
+
+void ReplaySensor::init()
+{
+    _pos = 0;
+    _cursor = _first_row;
+    _record = {0.0, 0.0, 0.0, 0.0};
+}
+
+bool ReplaySensor::parseRow(TelemetryRecord &row)
+{
+    const char *end = _file.data() + _file.size();
+    const char *p = skipBlankLines(_cursor, end);
+    if (!parseField(p, end, ',', row.time) || !parseField(p, end, ',', row.target) ||
+        !parseField(p, end, ',', row.actual) || !parseField(p, end, '\n', row.output))
+        return false;
+    _cursor = p;
+    return true;
+}
+
+double ReplaySensor::nextRecord()
+{
+    if (_format == ReplayFormat::Float32)
+    {
+        const float *columns[BinaryTelemetryWriter::kColumnCount];
+        for (std::size_t c = 0; c < BinaryTelemetryWriter::kColumnCount; c++)
+            columns[c] = reinterpret_cast<const float *>(_columns[c]);
+        _record = {columns[0][_pos], columns[1][_pos], columns[2][_pos], columns[3][_pos]};
+        _pos++;
+        return _record.actual;
+    }
+
+    if (!parseRow(_record))
+        throw std::runtime_error("Malformed telemetry row " + std::to_string(_pos + 1));
+    _pos++;
+    return _record.actual;
+}
+
+TelemetryRecord ReplaySensor::record() const
+{
+    if (_format != ReplayFormat::Float64 || _pos == 0)
+        return _record;
+    const std::size_t i = _pos - 1;
+    return {column(0)[i], column(1)[i], _actual[i], column(3)[i]};
+}
+
+const double *ReplaySensor::column(std::size_t c) const
+{
+    if (_format != ReplayFormat::Float64 || c >= BinaryTelemetryWriter::kColumnCount)
+        return nullptr;
+    return reinterpret_cast<const double *>(_columns[c]);
+}
+
+std::size_t ReplaySensor::readBatch(double *values, double *timestamps, std::size_t count)
+{
+    const std::size_t n = std::min(count, _steps - _pos);
+
+    // Float64: straight copies out of the mapping
+    if (_format == ReplayFormat::Float64)
+    {
+        if (n == 0)
+            return 0;
+        std::memcpy(values, _actual + _pos, n * sizeof(double));
+        if (timestamps)
+            std::memcpy(timestamps, column(0) + _pos, n * sizeof(double));
+        _pos += n;
+        _record.actual = values[n - 1];
+        return n;
+    }
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        values[i] = nextRecord();
+        if (timestamps)
+            timestamps[i] = _record.time;
+    }
+    return n;
+}
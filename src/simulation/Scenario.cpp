@@ -0,0 +1,252 @@
+#include "Scenario.hpp"
+#include <cctype>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include "MockSensor.hpp"
+#include "PID.hpp"
+#include "Plant.hpp"
+
+namespace
+{
+    struct Disturbance
+    {
+        int start;
+        int steps;
+        double force;
+    };
+
+    // Scenario under construction
+    struct Builder
+    {
+        Scenario scenario;
+        std::vector<Disturbance> disturbances;
+        double last_setpoint;
+        bool has_segment = false;
+
+        explicit Builder(const std::string &name)
+        {
+            scenario.name = name;
+            last_setpoint = scenario.mission.initial_altitude;
+        }
+
+        void startSegment()
+        {
+            if (!has_segment)
+                last_setpoint = scenario.mission.initial_altitude;
+            scenario.final_segment_start = static_cast<int>(scenario.setpoint.size());
+            scenario.mission.target1 = has_segment ? last_setpoint : scenario.mission.initial_altitude;
+            has_segment = true;
+        }
+
+        Scenario finish()
+        {
+            Scenario &s = scenario;
+            const int steps = static_cast<int>(s.setpoint.size());
+            s.disturbance.assign(steps, 0.0);
+            for (const Disturbance &d : disturbances)
+                for (int i = std::max(d.start, 0); i < std::min(d.start + d.steps, steps); i++)
+                    s.disturbance[i] += d.force;
+
+            s.mission.steps = steps;
+            s.mission.switch_step = s.final_segment_start;
+            s.mission.target2 = s.setpoint.back();
+            return s;
+        }
+    };
+
+    // Names end up in file names (scenario_<name>.csv) and CSV rows
+    bool validName(const std::string &name)
+    {
+        for (char c : name)
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '-')
+                return false;
+        return !name.empty();
+    }
+
+    [[noreturn]] void fail(int line, const std::string &message)
+    {
+        throw std::runtime_error("line " + std::to_string(line) + ": " + message);
+    }
+}
+
+Metrics Scenario::metrics() const
+{
+    // Start value decides the overshoot direction: the setpoint the final segment leaves from
+    double start_value = (final_segment_start > 0) ? setpoint[final_segment_start - 1] : mission.initial_altitude;
+    return Metrics(final_segment_start, setpoint.back(), start_value, mission.dt);
+}
+
+std::vector<Scenario> parseScenarios(std::istream &in)
+{
+    std::vector<Scenario> scenarios;
+    std::vector<Builder> builders;
+    auto current = [&]() -> Builder & {
+        if (builders.empty())
+            builders.emplace_back("scenario1");
+        return builders.back();
+    };
+
+    std::string text;
+    for (int line = 1; std::getline(in, text); line++)
+    {
+        std::size_t hash = text.find('#');
+        if (hash != std::string::npos)
+            text.erase(hash);
+        std::istringstream tokens(text);
+        std::string keyword;
+        if (!(tokens >> keyword))
+            continue;
+
+        Builder *b = (keyword == "scenario") ? nullptr : &current();
+        bool ok = true;
+        if (keyword == "scenario")
+        {
+            std::string name;
+            ok = static_cast<bool>(tokens >> name);
+            if (ok && !validName(name))
+                fail(line, "scenario name '" + name + "' may only use letters, digits, '_' and '-'");
+            for (const Builder &other : builders)
+                if (ok && other.scenario.name == name)
+                    fail(line, "duplicate scenario '" + name + "'");
+            builders.emplace_back(name);
+        }
+        else if (keyword == "dt")
+        {
+            ok = (tokens >> b->scenario.mission.dt) && b->scenario.mission.dt > 0;
+        }
+        else if (keyword == "initial")
+        {
+            if (b->has_segment)
+                fail(line, "initial must come before the first segment");
+            ok = static_cast<bool>(tokens >> b->scenario.mission.initial_altitude);
+        }
+        else if (keyword == "limits")
+        {
+            MissionProfile &m = b->scenario.mission;
+            ok = (tokens >> m.min_output >> m.max_output) && m.min_output < m.max_output;
+        }
+        else if (keyword == "noise")
+        {
+            std::string distribution;
+            SensorNoise &noise = b->scenario.mission.noise;
+            ok = static_cast<bool>(tokens >> distribution >> noise.amplitude);
+            if (ok && distribution == "gaussian")
+                noise.distribution = NoiseDistribution::Gaussian;
+            else if (ok && distribution == "uniform")
+                noise.distribution = NoiseDistribution::Uniform;
+            else
+                ok = false;
+            std::uint64_t seed;
+            if (ok && tokens >> seed)
+                noise.seed = seed;
+        }
+        else if (keyword == "plant")
+        {
+            std::string type, method;
+            PlantConfig &plant = b->scenario.mission.plant;
+            ok = (tokens >> type) && parsePlantType(type, plant.type);
+            if (ok && tokens >> method)
+                ok = parseIntegratorMethod(method, plant.integrator);
+        }
+        else if (keyword == "substeps")
+        {
+            int &substeps = b->scenario.mission.plant.substeps;
+            ok = (tokens >> substeps) && substeps > 0;
+        }
+        else if (keyword == "vehicle")
+        {
+            VehicleParams &v = b->scenario.mission.plant.vehicle;
+            ok = (tokens >> v.mass >> v.thrust_gain >> v.max_thrust >> v.drag >> v.motor_tau) && v.mass > 0 &&
+                 v.max_thrust >= 0 && v.motor_tau >= 0;
+        }
+        else if (keyword == "hold" || keyword == "ramp")
+        {
+            int steps = 0;
+            double altitude = 0.0;
+            ok = (tokens >> steps >> altitude) && steps > 0;
+            if (ok)
+            {
+                b->startSegment();
+                const double from = b->last_setpoint;
+                for (int i = 0; i < steps; i++)
+                    b->scenario.setpoint.push_back((keyword == "hold") ? altitude : from + (altitude - from) * (i + 1) / steps);
+                b->last_setpoint = altitude;
+            }
+        }
+        else if (keyword == "disturbance")
+        {
+            Disturbance d;
+            ok = (tokens >> d.start >> d.steps >> d.force) && d.steps > 0 && d.start >= 0;
+            if (ok)
+                b->disturbances.push_back(d);
+        }
+        else
+        {
+            fail(line, "unknown keyword '" + keyword + "'");
+        }
+
+        if (!ok)
+            fail(line, "malformed '" + keyword + "'");
+    }
+
+    for (Builder &b : builders)
+    {
+        if (b.scenario.setpoint.empty())
+            throw std::runtime_error("scenario '" + b.scenario.name + "' has no hold or ramp segment");
+        scenarios.push_back(b.finish());
+    }
+    return scenarios;
+}
+
+std::vector<Scenario> loadScenarios(const std::string &path)
+{
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error("Cannot open scenario file " + path);
+    return parseScenarios(file);
+}
+
+Scenario scenarioFromMission(const MissionProfile &mission, const std::string &name)
+{
+    Scenario scenario;
+    scenario.name = name;
+    scenario.mission = mission;
+    const int steps = std::max(mission.steps, 0);
+    scenario.setpoint.resize(steps);
+    for (int i = 0; i < steps; i++)
+        scenario.setpoint[i] = mission.targetAt(i);
+    scenario.disturbance.assign(steps, 0.0);
+    scenario.final_segment_start = (mission.switch_step > 0 && mission.switch_step < mission.steps) ? mission.switch_step : 0;
+    return scenario;
+}
+
+MetricsSummary runScenario(const PIDGains &gains, const Scenario &scenario, TelemetryWriter *telemetry)
+{
+    const MissionProfile &mission = scenario.mission;
+    PID pid(gains.kp, gains.ki, gains.kd, mission.dt, mission.max_output, mission.min_output, mission.pid);
+    MockSensor altimeter(mission.initial_altitude, mission.noise);
+    std::unique_ptr<Plant> plant = makePlant(mission.plant, mission.initial_altitude);
+    Metrics metrics = scenario.metrics();
+
+    const double *setpoint = scenario.setpoint.data();
+    const double *disturbance = scenario.disturbance.data();
+    const int steps = static_cast<int>(scenario.setpoint.size());
+
+    for (int i = 0; i < steps; i++)
+    {
+        double current_target = setpoint[i];
+
+        double current_alt = altimeter.readValue();
+        double motor_power = pid.calculate(current_target, current_alt);
+        plant->step(motor_power + disturbance[i], mission.dt);
+        altimeter.setValue(plant->altitude());
+
+        metrics.update(i, current_target, current_alt);
+        if (telemetry)
+            telemetry->write({i * mission.dt, current_target, current_alt, motor_power});
+    }
+
+    return metrics.summary();
+}
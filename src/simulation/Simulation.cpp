@@ -0,0 +1,155 @@
+#include "Simulation.hpp"
+#include "ControlLoop.hpp"
+#include "PID.hpp"
+#include "PIDBatch.hpp"
+#include "Plant.hpp"
+#include "MockSensor.hpp"
+#include <algorithm>
+#include <memory>
+
+MissionTrace simulate(const PIDGains &gains, const MissionProfile &mission)
+{
+    MissionTrace trace;
+    trace.time.reserve(mission.steps);
+    trace.target.reserve(mission.steps);
+    trace.actual.reserve(mission.steps);
+    trace.output.reserve(mission.steps);
+
+    PID pid(gains.kp, gains.ki, gains.kd, mission.dt, mission.max_output, mission.min_output, mission.pid);
+    MockSensor altimeter(mission.initial_altitude, mission.noise);
+    std::unique_ptr<Plant> plant = makePlant(mission.plant, mission.initial_altitude);
+
+    // Same loop as main.cpp, recorded into memory instead of telemetry.csv
+    for (int i = 0; i < mission.steps; i++)
+    {
+        double current_target = mission.targetAt(i);
+
+        double current_alt = altimeter.readValue();
+        double motor_power = pid.calculate(current_target, current_alt);
+        plant->step(motor_power, mission.dt);
+        altimeter.setValue(plant->altitude());
+
+        trace.time.push_back(i * mission.dt);
+        trace.target.push_back(current_target);
+        trace.actual.push_back(current_alt);
+        trace.output.push_back(motor_power);
+    }
+
+    return trace;
+}
+
+MetricsSummary simulateMetrics(const PIDGains &gains, const MissionProfile &mission)
+{
+    PID pid(gains.kp, gains.ki, gains.kd, mission.dt, mission.max_output, mission.min_output, mission.pid);
+    return runControlLoop(pid, mission);
+}
+
+std::vector<MetricsSummary> simulateBatch(const std::vector<PIDGains> &candidates, const MissionProfile &mission)
+{
+    const std::size_t n = candidates.size();
+
+    PIDBatch pid(n, mission.dt, mission.max_output, mission.min_output, mission.pid);
+    for (std::size_t c = 0; c < n; c++)
+        pid.setGains(c, candidates[c].kp, candidates[c].ki, candidates[c].kd);
+
+    // Every lane sees the same noise stream as a scalar run with this mission
+    std::vector<MockSensor> altimeters(n, MockSensor(mission.initial_altitude, mission.noise));
+    std::vector<Metrics> metrics(n, Metrics(mission));
+    PlantBatch plant(n, mission.plant, mission.initial_altitude);
+
+    std::vector<double> setpoint(n), altitude(n), motor_power(n);
+
+    for (int i = 0; i < mission.steps; i++)
+    {
+        double current_target = mission.targetAt(i);
+        std::fill(setpoint.begin(), setpoint.end(), current_target);
+
+        for (std::size_t c = 0; c < n; c++)
+            altitude[c] = altimeters[c].readValue();
+
+        pid.calculate(setpoint.data(), altitude.data(), motor_power.data());
+        plant.step(motor_power.data(), mission.dt);
+
+        for (std::size_t c = 0; c < n; c++)
+        {
+            altimeters[c].setValue(plant.altitude(c));
+            metrics[c].update(i, current_target, altitude[c]);
+        }
+    }
+
+    std::vector<MetricsSummary> results;
+    results.reserve(n);
+    for (const Metrics &m : metrics)
+        results.push_back(m.summary());
+    return results;
+}
+
+RunResult simulateBounded(const PIDGains &gains, const MissionProfile &mission, const RunLimits &limits)
+{
+    PID pid(gains.kp, gains.ki, gains.kd, mission.dt, mission.max_output, mission.min_output, mission.pid);
+    MockSensor altimeter(mission.initial_altitude, mission.noise);
+    return withPlant(mission.plant, mission.initial_altitude,
+                     [&](auto &plant) { return runControlLoopBounded(pid, altimeter, plant, mission, limits); });
+}
+
+std::vector<RunResult> simulateBatchBounded(const std::vector<PIDGains> &candidates, const MissionProfile &mission,
+                                            const std::vector<double> &rmse_bounds, const RunLimits &limits)
+{
+    const std::size_t n = candidates.size();
+
+    PIDBatch pid(n, mission.dt, mission.max_output, mission.min_output, mission.pid);
+    for (std::size_t c = 0; c < n; c++)
+        pid.setGains(c, candidates[c].kp, candidates[c].ki, candidates[c].kd);
+
+    std::vector<MockSensor> altimeters(n, MockSensor(mission.initial_altitude, mission.noise));
+    std::vector<Metrics> metrics(n, Metrics(mission));
+    PlantBatch plant(n, mission.plant, mission.initial_altitude);
+    std::vector<RunResult> results(n, RunResult{MetricsSummary{0.0, 0.0, 0.0, 0}, RunStatus::Completed, mission.steps});
+    std::vector<RunMonitor> monitors;
+    monitors.reserve(n);
+    for (std::size_t c = 0; c < n; c++)
+    {
+        RunLimits lane_limits = limits;
+        lane_limits.rmse_bound = rmse_bounds[c];
+        monitors.emplace_back(lane_limits, mission);
+    }
+    std::vector<char> active(n, 1);
+    std::size_t remaining = n;
+
+    std::vector<double> setpoint(n), altitude(n), motor_power(n);
+
+    for (int i = 0; i < mission.steps && remaining > 0; i++)
+    {
+        double current_target = mission.targetAt(i);
+        std::fill(setpoint.begin(), setpoint.end(), current_target);
+
+        // Aborted lanes keep their last reading; the SIMD kernels still step them, but nothing reads the result
+        for (std::size_t c = 0; c < n; c++)
+            if (active[c])
+                altitude[c] = altimeters[c].readValue();
+
+        pid.calculate(setpoint.data(), altitude.data(), motor_power.data());
+        plant.step(motor_power.data(), mission.dt);
+
+        for (std::size_t c = 0; c < n; c++)
+        {
+            if (!active[c])
+                continue;
+            altimeters[c].setValue(plant.altitude(c));
+            metrics[c].update(i, current_target, altitude[c]);
+
+            RunStatus status = monitors[c].check(metrics[c], current_target, altitude[c], motor_power[c]);
+            if (status != RunStatus::Completed)
+            {
+                active[c] = 0;
+                remaining--;
+                results[c].status = status;
+                results[c].steps = i + 1;
+            }
+        }
+    }
+
+    for (std::size_t c = 0; c < n; c++)
+        results[c].metrics = metrics[c].summary();
+    return results;
+}
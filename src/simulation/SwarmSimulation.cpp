@@ -0,0 +1,133 @@
+#include "SwarmSimulation.hpp"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include "Noise.hpp"
+#include "PIDBatch.hpp"
+#include "Plant.hpp"
+#include "ThreadPool.hpp"
+
+namespace
+{
+    // Same block size as MockSensor, so each lane sees the identical noise stream
+    const std::size_t kNoiseBlock = 64;
+}
+
+SwarmSimulation::SwarmSimulation(const SwarmConfig &config)
+    : _config(config), _lanes(0)
+{
+    if (config.vehicles <= 0 || config.axes <= 0)
+        throw std::invalid_argument("SwarmSimulation: vehicles and axes must be positive");
+    _lanes = static_cast<std::size_t>(config.vehicles) * static_cast<std::size_t>(config.axes);
+}
+
+void SwarmSimulation::run()
+{
+    const std::size_t steps = std::max(_config.mission.steps, 0);
+    _metrics.assign(_lanes, MetricsSummary{0.0, 0.0, 0.0, 0});
+    if (_config.record)
+    {
+        _actual.assign(_lanes * steps, 0.0);
+        _output.assign(_lanes * steps, 0.0);
+    }
+
+    // Shard on vehicle boundaries so a vehicle's axes stay together
+    ThreadPool pool(_config.threads);
+    const std::size_t axes = static_cast<std::size_t>(_config.axes);
+    const std::size_t vehicles = static_cast<std::size_t>(_config.vehicles);
+    const std::size_t vehicles_per_shard = std::max<std::size_t>(1, (vehicles + pool.size() - 1) / pool.size());
+    pool.parallelFor(vehicles, vehicles_per_shard, [this, axes](std::size_t begin, std::size_t end) {
+        runShard(begin * axes, end * axes);
+    });
+}
+
+void SwarmSimulation::runShard(std::size_t begin, std::size_t end)
+{
+    const MissionProfile &mission = _config.mission;
+    const std::size_t n = end - begin;
+    const int steps = mission.steps;
+
+    // 1. Shard-local SoA state
+    PIDBatch pid(n, mission.dt, mission.max_output, mission.min_output, mission.pid);
+    std::vector<NoiseGenerator> noise;
+    std::vector<Metrics> metrics(n, Metrics(mission));
+    noise.reserve(n);
+    for (std::size_t l = 0; l < n; l++)
+    {
+        pid.setGains(l, _config.gains.kp, _config.gains.ki, _config.gains.kd);
+        SensorNoise lane_noise = mission.noise;
+        lane_noise.seed = mission.noise.seed + begin + l;
+        noise.emplace_back(lane_noise);
+    }
+
+    PlantBatch plant(n, mission.plant, mission.initial_altitude);
+    const double *position = plant.altitude();
+    std::vector<double> reading(n), setpoint(n), output(n);
+    std::vector<double> noise_block(kNoiseBlock * n); // [k * n + lane]: one contiguous row per tick
+    std::vector<double> lane_block(kNoiseBlock);
+
+    // 2. Tick loop
+    for (int i = 0; i < steps; i++)
+    {
+        const std::size_t k = i % kNoiseBlock;
+        if (k == 0)
+        {
+            for (std::size_t l = 0; l < n; l++)
+            {
+                noise[l].fill(lane_block.data(), kNoiseBlock);
+                for (std::size_t j = 0; j < kNoiseBlock; j++)
+                    noise_block[j * n + l] = lane_block[j];
+            }
+        }
+
+        const double target = mission.targetAt(i);
+        const double *noise_row = noise_block.data() + k * n;
+        for (std::size_t l = 0; l < n; l++)
+        {
+            reading[l] = position[l] + noise_row[l];
+            setpoint[l] = target;
+        }
+
+        pid.calculate(setpoint.data(), reading.data(), output.data());
+        plant.step(output.data(), mission.dt);
+
+        for (std::size_t l = 0; l < n; l++)
+        {
+            metrics[l].update(i, target, reading[l]);
+        }
+
+        if (_config.record)
+        {
+            for (std::size_t l = 0; l < n; l++)
+            {
+                _actual[(begin + l) * steps + i] = reading[l];
+                _output[(begin + l) * steps + i] = output[l];
+            }
+        }
+    }
+
+    for (std::size_t l = 0; l < n; l++)
+        _metrics[begin + l] = metrics[l].summary();
+}
+
+void SwarmSimulation::writeTelemetryCsv(const std::string &path) const
+{
+    if (!_config.record)
+        throw std::logic_error("SwarmSimulation: telemetry was not recorded (set SwarmConfig::record)");
+
+    const MissionProfile &mission = _config.mission;
+    std::ofstream file(path);
+    file << "Vehicle,Axis,Time,Target,Actual,Output\n";
+    for (int v = 0; v < _config.vehicles; v++)
+    {
+        for (int a = 0; a < _config.axes; a++)
+        {
+            const std::size_t base = lane(v, a) * mission.steps;
+            for (int i = 0; i < mission.steps; i++)
+            {
+                file << v << "," << a << "," << i * mission.dt << "," << mission.targetAt(i) << ","
+                     << _actual[base + i] << "," << _output[base + i] << "\n";
+            }
+        }
+    }
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ControlLoop.hpp"
+#include "ControllerGraph.hpp"
+#include "PID.hpp"
+
+static_assert(is_controller_v<ControllerGraph>, "A graph plugs into the templated loops");
+
+// Test 1: A single PID stage is bit-identical to PID
+TEST(ControllerGraphTest, SingleStageMatchesPID)
+{
+    ControllerGraph graph(0.1);
+    Signal sp = graph.input("setpoint");
+    Signal pv = graph.input("pv");
+    graph.output("u", graph.pid(sp, pv, {0.6, 0.01, 0.05, 500.0, -500.0}));
+    graph.compile();
+
+    PID pid(0.6, 0.01, 0.05, 0.1, 500.0, -500.0);
+    for (int i = 0; i < 500; i++)
+    {
+        double reading = 30.0 * std::sin(0.03 * i);
+        ASSERT_EQ(graph.calculate(100.0, reading), pid.calculate(100.0, reading)) << "step " << i;
+    }
+
+    graph.reset();
+    pid.reset();
+    EXPECT_EQ(graph.calculate(10.0, 2.0), pid.calculate(10.0, 2.0));
+}
+
+// Test 2: Parallel loops run side by side and match independent PIDs
+TEST(ControllerGraphTest, ParallelLoops)
+{
+    ControllerGraph graph(0.01);
+    std::vector<PID> pids;
+    std::vector<Signal> sp, pv;
+    const char *axes[] = {"roll", "pitch", "yaw"};
+    for (int a = 0; a < 3; a++)
+    {
+        sp.push_back(graph.input(std::string(axes[a]) + "_sp"));
+        pv.push_back(graph.input(axes[a]));
+        graph.output(axes[a], graph.pid(sp[a], pv[a], {1.0 + a, 0.1 * a, 0.02, 10.0, -10.0}));
+        pids.emplace_back(1.0 + a, 0.1 * a, 0.02, 0.01, 10.0, -10.0);
+    }
+    graph.compile();
+    EXPECT_EQ(graph.scheduleSize(), 3u);
+    EXPECT_EQ(graph.inputCount(), 6u);
+    EXPECT_EQ(graph.outputCount(), 3u);
+
+    for (int i = 0; i < 200; i++)
+    {
+        for (int a = 0; a < 3; a++)
+        {
+            graph.set(sp[a], 0.5 * a);
+            graph.set(pv[a], std::cos(0.1 * i + a));
+        }
+        graph.step();
+        for (int a = 0; a < 3; a++)
+            ASSERT_EQ(graph.value(a), pids[a].calculate(0.5 * a, std::cos(0.1 * i + a))) << "axis " << a;
+    }
+}
+
+// Test 3: Filters, feed-forward and limiters; dead stages are dropped
+TEST(ControllerGraphTest, StagesAndDeadCodeElimination)
+{
+    ControllerGraph graph(0.1);
+    Signal in = graph.input("x");
+    Signal ff = graph.input("ff");
+    graph.gain(in, 100.0); // Not connected to an output
+    Signal filtered = graph.lowPass(in, 0.9); // alpha = 0.1
+    Signal rate = graph.derivative(in);
+    Signal limited = graph.clamp(graph.sum(filtered, ff, 2.0), -1.0, 3.0);
+    graph.output("limited", limited);
+    graph.output("rate", rate);
+    graph.compile();
+    EXPECT_EQ(graph.scheduleSize(), 4u);
+
+    graph.set(in, 1.0);
+    graph.set(ff, 0.0);
+    graph.step();
+    EXPECT_DOUBLE_EQ(graph.value(0), 1.0); // Filter starts at its first input
+    EXPECT_EQ(graph.value(1), 0.0);        // No rate on the first step
+
+    graph.set(in, 2.0);
+    graph.set(ff, 10.0);
+    graph.step();
+    EXPECT_DOUBLE_EQ(graph.signal(filtered), 1.1);
+    EXPECT_EQ(graph.value(0), 3.0); // 1.1 + 20 clamped
+    EXPECT_DOUBLE_EQ(graph.value(1), 10.0);
+
+    EXPECT_THROW(graph.gain(in, 1.0), std::logic_error);
+}
+
+// Test 4: Anti-windup keeps the integrator from charging while saturated
+TEST(ControllerGraphTest, AntiWindupLimitsOvershoot)
+{
+    auto fly = [](bool anti_windup) {
+        ControllerGraph graph(0.1);
+        Signal sp = graph.input("setpoint");
+        Signal pv = graph.input("pv");
+        PIDOptions options;
+        options.anti_windup = anti_windup ? AntiWindup::Conditional : AntiWindup::None;
+        graph.output("u", graph.pid(sp, pv, {0.5, 0.5, 0.0, 5.0, -5.0, options}));
+        graph.compile();
+
+        double z = 0.0, peak = 0.0;
+        for (int i = 0; i < 600; i++)
+        {
+            z += graph.calculate(50.0, z) * 0.1;
+            peak = std::max(peak, z);
+        }
+        return peak;
+    };
+
+    EXPECT_LT(fly(true), 55.0);  // ~53 m
+    EXPECT_GT(fly(false), 80.0); // ~95 m
+}
+
+// Test 5: The altitude -> velocity cascade flies the vehicle plant
+TEST(ControllerGraphTest, CascadeFliesVehicle)
+{
+    MissionProfile mission;
+    mission.plant.type = PlantType::Vehicle;
+    mission.noise.amplitude = 0.1;
+
+    ControllerGraph cascade = makeAltitudeCascade({0.8, 0.0, 0.0, 5.0, -5.0}, {60.0, 20.0, 0.0, 500.0, -500.0, {0.0, false, AntiWindup::Conditional}},
+                                                  0.3, mission.dt);
+    EXPECT_EQ(cascade.inputSignal("altitude"), 1u);
+    MetricsSummary summary = runControlLoop(cascade, mission);
+
+    EXPECT_TRUE(std::isfinite(summary.settling_time));
+    EXPECT_LT(summary.overshoot_percent, 5.0);
+}
+
+// Test 6: Stages take the full PIDOptions and stay bit-identical to PID with every one of them
+TEST(ControllerGraphTest, StageOptionsMatchPID)
+{
+    PIDOptions options;
+    options.derivative_filter = 0.2;
+    options.derivative_on_measurement = true;
+    for (AntiWindup mode : {AntiWindup::None, AntiWindup::Conditional, AntiWindup::BackCalculation})
+    {
+        options.anti_windup = mode;
+        ControllerGraph graph(0.1);
+        Signal sp = graph.input("setpoint");
+        Signal pv = graph.input("pv");
+        graph.output("u", graph.pid(sp, pv, {2.0, 0.8, 0.3, 20.0, -20.0, options}));
+        graph.compile();
+
+        PID pid(2.0, 0.8, 0.3, 0.1, 20.0, -20.0, options);
+        for (int i = 0; i < 400; i++)
+        {
+            double setpoint = (i < 200) ? 100.0 : 20.0; // Saturates both ways
+            double reading = 60.0 + 30.0 * std::sin(0.05 * i);
+            ASSERT_EQ(graph.calculate(setpoint, reading), pid.calculate(setpoint, reading)) << "step " << i;
+        }
+    }
+}
+
+// Test 7: calculate() needs a compiled graph with setpoint and measurement inputs
+TEST(ControllerGraphTest, CalculateChecksInputs)
+{
+    ControllerGraph single(0.1);
+    single.output("u", single.gain(single.input("x"), 2.0));
+    single.compile();
+    EXPECT_THROW(single.calculate(1.0, 2.0), std::logic_error);
+
+    ControllerGraph uncompiled(0.1);
+    Signal sp = uncompiled.input("setpoint");
+    uncompiled.output("u", uncompiled.pid(sp, uncompiled.input("pv"), {1.0, 0.0, 0.0, 5.0, -5.0}));
+    EXPECT_THROW(uncompiled.calculate(1.0, 2.0), std::logic_error);
+}
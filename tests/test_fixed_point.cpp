@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "BasicPID.hpp"
+#include "ControlLoop.hpp"
+#include "FixedPoint.hpp"
+#include "PID.hpp"
+#include "PIDT.hpp"
+#include "PrecisionCompare.hpp"
+
+namespace
+{
+    struct AltitudeHold
+    {
+        static constexpr double kp = 0.6, ki = 0.01, kd = 0.05;
+        static constexpr double dt = 0.1, max_output = 500.0, min_output = -500.0;
+    };
+}
+
+static_assert(is_controller_v<BasicPID<Q16_16>>, "Fixed-point PID plugs into the templated loops");
+
+// Test 1: Q-format arithmetic rounds to the nearest LSB and saturates instead of wrapping
+TEST(FixedPointTest, ArithmeticAndSaturation)
+{
+    EXPECT_EQ(Q16_16(1.5).raw(), 3 << 15);
+    EXPECT_EQ(static_cast<double>(Q16_16(-2.25)), -2.25);
+    EXPECT_EQ(static_cast<double>(Q16_16(3.0) * Q16_16(-0.5)), -1.5);
+    EXPECT_EQ(static_cast<double>(Q16_16(1.0) - Q16_16(0.25)), 0.75);
+    EXPECT_NEAR(static_cast<double>(Q12_20(0.001)), 0.001, 1.0 / Q12_20::scale);
+
+    EXPECT_EQ(Q16_16(1e9), Q16_16::max());
+    EXPECT_EQ(Q16_16(30000.0) + Q16_16(30000.0), Q16_16::max());
+    EXPECT_EQ(Q16_16(-300.0) * Q16_16(300.0), Q16_16::lowest());
+    EXPECT_EQ(-Q16_16::lowest(), Q16_16::max());
+    EXPECT_LT(Q16_16(-1.0), Q16_16(0.5));
+}
+
+// Test 2: BasicPID in double tracks PID; the compile-time PIDT runs in fixed point too
+TEST(FixedPointTest, BasicPIDMatchesPID)
+{
+    PID reference(0.6, 0.01, 0.05, 0.1, 500.0, -500.0);
+    BasicPID<double> basic(0.6, 0.01, 0.05, 0.1, 500.0, -500.0);
+    PIDT<AltitudeHold, Q16_16> fixed;
+    for (int i = 0; i < 200; i++)
+    {
+        double pv = 40.0 * std::sin(0.05 * i);
+        double expected = reference.calculate(100.0, pv);
+        ASSERT_NEAR(basic.calculate(100.0, pv), expected, 1e-9);
+        // ki * dt = 0.001 rounds to 66 LSB in Q16.16 (+0.7 %), so the integral drifts slowly
+        ASSERT_NEAR(static_cast<double>(fixed.calculate(Q16_16(100.0), Q16_16(pv))), expected, 0.5);
+    }
+
+    basic.reset();
+    EXPECT_EQ(basic.calculate(10.0, 0.0), BasicPID<double>(0.6, 0.01, 0.05, 0.1, 500.0, -500.0).calculate(10.0, 0.0));
+}
+
+// Test 3: Every representation flies the default mission close to the reference
+TEST(FixedPointTest, ComparePrecision)
+{
+    MissionProfile mission;
+    std::vector<PrecisionReport> reports = comparePrecision({0.6, 0.01, 0.05}, mission, 2);
+    ASSERT_EQ(reports.size(), 5u);
+
+    EXPECT_EQ(reports[0].type, NumericType::Reference);
+    EXPECT_EQ(reports[0].max_altitude_error, 0.0);
+    EXPECT_EQ(reports[0].max_output_error, 0.0);
+    EXPECT_LT(reports[1].max_output_error, 1e-9); // Same maths, different association
+    for (const PrecisionReport &r : reports)
+    {
+        EXPECT_LT(r.max_altitude_error, 0.1) << numericTypeName(r.type);
+        EXPECT_NEAR(r.metrics.rmse, reports[0].metrics.rmse, 0.01) << numericTypeName(r.type);
+        EXPECT_GT(r.ns_per_step, 0.0);
+    }
+
+    // More fraction bits, less divergence
+    EXPECT_LT(reports[4].max_output_error, reports[3].max_output_error);
+}
+
+// Test 4: A negative step count flies nothing instead of sizing the traces
+TEST(FixedPointTest, NegativeStepsFlyNothing)
+{
+    MissionProfile mission;
+    mission.steps = -5;
+    std::vector<PrecisionReport> reports = comparePrecision({0.6, 0.01, 0.05}, mission, 1);
+    ASSERT_EQ(reports.size(), 5u);
+    EXPECT_EQ(reports[2].max_altitude_error, 0.0);
+    EXPECT_EQ(reports[2].ns_per_step, 0.0);
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include "Instrumentation.hpp"
+
+// Test 1: ScopedTimer records the duration of its scope
+TEST(InstrumentationTest, ScopedTimerRecords)
+{
+    LatencyHistogram h;
+    {
+        ScopedTimer timer(h);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    ASSERT_EQ(h.count(), 1u);
+    EXPECT_GE(h.max(), 1500000u); // At least ~2 ms, allowing for TSC calibration error
+}
+
+// Test 2: The macro only exists in instrumented builds; otherwise its
+// argument is not evaluated at all
+TEST(InstrumentationTest, MacroCompiledOutWhenDisabled)
+{
+    int evaluated = 0;
+    LatencyHistogram h;
+    [[maybe_unused]] auto touch = [&]() -> LatencyHistogram & { evaluated++; return h; }; // Unused when compiled out
+    {
+        AEROSTREAM_SCOPED_TIMER(touch());
+    }
+#ifdef AEROSTREAM_ENABLE_INSTRUMENTATION
+    EXPECT_EQ(evaluated, 1);
+    EXPECT_EQ(h.count(), 1u);
+#else
+    EXPECT_EQ(evaluated, 0);
+    EXPECT_EQ(h.count(), 0u);
+#endif
+}
+
+// Test 3: JSON dump lists every stage with its percentiles
+TEST(InstrumentationTest, ProfilerJson)
+{
+    LoopProfiler profiler;
+    for (int i = 1; i <= 100; i++)
+        profiler.stage(LoopStage::Controller).record(i * 10);
+
+    std::ostringstream out;
+    profiler.writeJson(out);
+    const std::string json = out.str();
+    EXPECT_NE(json.find("\"controller\": {\"count\": 100"), std::string::npos);
+    EXPECT_NE(json.find("\"p999_ns\""), std::string::npos);
+    EXPECT_NE(json.find("\"tick\""), std::string::npos);
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "LatencyHistogram.hpp"
+
+// Test 1: Small values are exact, large ones within the bucket precision
+TEST(LatencyHistogramTest, PercentilesWithinPrecision)
+{
+    LatencyHistogram h;
+    for (std::uint64_t v = 1; v <= 10000; v++)
+        h.record(v * 1000); // 1 us .. 10 ms
+
+    EXPECT_EQ(h.count(), 10000u);
+    EXPECT_EQ(h.min(), 1000u);
+    EXPECT_EQ(h.max(), 10000000u);
+    EXPECT_NEAR(static_cast<double>(h.percentile(0.5)), 5.0e6, 5.0e6 * 0.04);
+    EXPECT_NEAR(static_cast<double>(h.percentile(0.99)), 9.9e6, 9.9e6 * 0.04);
+    EXPECT_EQ(h.percentile(1.0), h.max());
+
+    LatencyHistogram small;
+    small.record(7);
+    EXPECT_EQ(small.percentile(0.5), 7u);
+}
+
+// Test 2: Merging two histograms equals recording into one
+TEST(LatencyHistogramTest, MergeAndReset)
+{
+    LatencyHistogram a, b, both;
+    for (std::uint64_t v = 0; v < 500; v++)
+    {
+        a.record(v * 37);
+        b.record(v * 91 + 5);
+        both.record(v * 37);
+        both.record(v * 91 + 5);
+    }
+    a.merge(b);
+    EXPECT_EQ(a.count(), both.count());
+    EXPECT_EQ(a.percentile(0.999), both.percentile(0.999));
+    EXPECT_EQ(a.mean(), both.mean());
+
+    a.reset();
+    EXPECT_EQ(a.count(), 0u);
+    EXPECT_EQ(a.percentile(0.5), 0u);
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Metrics.hpp"
+
+// Test 1: A perfect response has zero error, zero overshoot and settles immediately
+TEST(MetricsTest, PerfectTracking)
+{
+    Metrics metrics(0, 100.0, 0.0, 0.1);
+    for (int i = 0; i < 10; i++)
+        metrics.update(i, 100.0, 100.0);
+
+    MetricsSummary s = metrics.summary();
+    EXPECT_EQ(s.samples, 10);
+    EXPECT_NEAR(s.rmse, 0.0, 1e-12);
+    EXPECT_NEAR(s.overshoot_percent, 0.0, 1e-12);
+    EXPECT_EQ(s.settling_time, 0.0);
+}
+
+// Test 2: Overshoot and settling time for a hand-made step response
+TEST(MetricsTest, OvershootAndSettling)
+{
+    // Samples: 0 -> 110 (10% overshoot) -> settles inside the 2% band from step 3
+    const double actual[] = {0.0, 50.0, 110.0, 101.0, 100.0, 99.5};
+    Metrics metrics(0, 100.0, 0.0, 0.1);
+    for (int i = 0; i < 6; i++)
+        metrics.update(i, 100.0, actual[i]);
+
+    MetricsSummary s = metrics.summary();
+    EXPECT_NEAR(s.overshoot_percent, 10.0, 1e-9);
+    EXPECT_NEAR(s.settling_time, 0.2, 1e-9); // Last out-of-band sample is step 2
+}
+
+// Test 3: Samples before the segment start are ignored, and a response that
+// is still outside the band at the end never settles
+TEST(MetricsTest, SegmentStartAndUnsettled)
+{
+    Metrics metrics(5, 100.0, 50.0, 0.1);
+    for (int i = 0; i < 5; i++)
+        metrics.update(i, 50.0, 0.0); // Would dominate the RMSE if counted
+    metrics.update(5, 100.0, 90.0);
+    metrics.update(6, 100.0, 90.0);
+
+    MetricsSummary s = metrics.summary();
+    EXPECT_EQ(s.samples, 2);
+    EXPECT_NEAR(s.rmse, 10.0, 1e-9);
+    EXPECT_TRUE(std::isinf(s.settling_time));
+}
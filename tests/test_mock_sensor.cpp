@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "MockSensor.hpp"
+
+// Test 1: Same seed, same noise; different seed, different noise
+TEST(MockSensorTest, SeedIsReproducible)
+{
+    SensorNoise noise;
+    noise.seed = 7;
+    MockSensor a(10.0, noise), b(10.0, noise);
+    noise.seed = 8;
+    MockSensor c(10.0, noise);
+
+    bool differs = false;
+    for (int i = 0; i < 200; i++)
+    {
+        double va = a.readValue();
+        EXPECT_EQ(va, b.readValue());
+        differs |= (va != c.readValue());
+    }
+    EXPECT_TRUE(differs);
+}
+
+// Test 2: Uniform noise stays within +/- amplitude and has (almost) zero mean
+TEST(MockSensorTest, UniformNoiseBounds)
+{
+    MockSensor sensor(0.0);
+    std::vector<double> noise(10000);
+    sensor.fillNoise(noise.data(), noise.size());
+
+    double sum = 0.0;
+    for (double n : noise)
+    {
+        EXPECT_GE(n, -0.5);
+        EXPECT_LT(n, 0.5);
+        sum += n;
+    }
+    EXPECT_NEAR(sum / noise.size(), 0.0, 0.02);
+}
+
+// Test 3: Gaussian noise has the configured standard deviation
+TEST(MockSensorTest, GaussianNoiseStddev)
+{
+    SensorNoise config;
+    config.distribution = NoiseDistribution::Gaussian;
+    config.amplitude = 2.0;
+    MockSensor sensor(0.0, config);
+
+    std::vector<double> noise(20001); // Odd count exercises the last Box-Muller pair
+    sensor.fillNoise(noise.data(), noise.size());
+
+    double sum = 0.0, sum_sq = 0.0;
+    for (double n : noise)
+    {
+        sum += n;
+        sum_sq += n * n;
+    }
+    double mean = sum / noise.size();
+    EXPECT_NEAR(mean, 0.0, 0.1);
+    EXPECT_NEAR(std::sqrt(sum_sq / noise.size() - mean * mean), 2.0, 0.1);
+}
+
+// Test 4: readValue() serves exactly the block-generated noise stream
+TEST(MockSensorTest, ReadValueMatchesFillNoise)
+{
+    MockSensor reader(5.0), filler(5.0);
+    std::vector<double> noise(150);
+    filler.fillNoise(noise.data(), 64);
+    filler.fillNoise(noise.data() + 64, 64);
+
+    for (int i = 0; i < 128; i++)
+        EXPECT_EQ(reader.readValue(), 5.0 + noise[i]);
+}
+
+// Test 5: readBatch() delivers the same samples as readValue(), with timestamps
+TEST(MockSensorTest, ReadBatchMatchesReadValue)
+{
+    MockSensor single(2.0), batch(2.0);
+    batch.setSamplePeriod(0.5);
+
+    std::vector<double> expected(300);
+    for (double &v : expected)
+        v = single.readValue();
+
+    // Odd chunk sizes cross block boundaries in every possible way
+    std::vector<double> values(300), stamps(300);
+    std::size_t done = batch.readBatch(values.data(), stamps.data(), 5);
+    done += batch.readBatch(values.data() + done, stamps.data() + done, 200);
+    done += batch.readBatch(values.data() + done, nullptr, 95);
+    ASSERT_EQ(done, 300u);
+
+    for (std::size_t i = 0; i < 300; i++)
+        EXPECT_EQ(values[i], expected[i]);
+    EXPECT_EQ(stamps[0], 0.0);
+    EXPECT_EQ(stamps[204], 204 * 0.5);
+}
+
+// Test 6: The ISensor fallback works for sensors that only implement readValue()
+TEST(MockSensorTest, DefaultReadBatchFallback)
+{
+    struct Constant : ISensor
+    {
+        void init() override {}
+        double readValue() override { return 4.2; }
+    } sensor;
+
+    double values[3], stamps[3];
+    EXPECT_EQ(sensor.readBatch(values, stamps, 3), 3u);
+    EXPECT_EQ(values[2], 4.2);
+    EXPECT_TRUE(std::isnan(stamps[0]));
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "MonteCarlo.hpp"
+#include "Simulation.hpp"
+
+static MissionProfile shortMission()
+{
+    MissionProfile mission;
+    mission.steps = 300;
+    mission.switch_step = 150;
+    return mission;
+}
+
+// Test 1: Every sample is simulateMetrics() of its own sample mission
+TEST(MonteCarloTest, SamplesMatchSingleRuns)
+{
+    MissionProfile mission = shortMission();
+    MonteCarloConfig config;
+    config.samples = 5;
+    config.threads = 2;
+    std::vector<PIDGains> candidates = {{0.6, 0.01, 0.05}, {1.2, 0.0, 0.1}};
+
+    std::vector<MonteCarloResult> results = runMonteCarlo(candidates, mission, config);
+    ASSERT_EQ(results.size(), 2u);
+
+    std::vector<double> rmse;
+    for (int s = 0; s < config.samples; s++)
+        rmse.push_back(simulateMetrics(candidates[1], monteCarloSample(mission, config, s, 1)).rmse);
+    SampleStats expected = sampleStats(rmse);
+    EXPECT_EQ(results[1].rmse.mean, expected.mean);
+    EXPECT_EQ(results[1].rmse.variance, expected.variance);
+    EXPECT_EQ(results[1].rmse.worst, expected.worst);
+    EXPECT_GT(results[1].rmse.variance, 0.0); // The seeds really differ
+    EXPECT_EQ(results[0].rmse_delta.mean, 0.0);
+}
+
+// Test 2: Results do not depend on the thread count
+TEST(MonteCarloTest, DeterministicAcrossThreads)
+{
+    MissionProfile mission = shortMission();
+    MonteCarloConfig config;
+    config.samples = 8;
+    config.common_random_numbers = false;
+    std::vector<PIDGains> candidates = {{0.6, 0.01, 0.05}, {0.3, 0.02, 0.0}};
+
+    config.threads = 1;
+    std::vector<MonteCarloResult> serial = runMonteCarlo(candidates, mission, config);
+    config.threads = 4;
+    std::vector<MonteCarloResult> parallel = runMonteCarlo(candidates, mission, config);
+    for (std::size_t c = 0; c < candidates.size(); c++)
+    {
+        EXPECT_EQ(serial[c].rmse.mean, parallel[c].rmse.mean);
+        EXPECT_EQ(serial[c].overshoot_percent.variance, parallel[c].overshoot_percent.variance);
+        EXPECT_EQ(serial[c].settling_time.worst, parallel[c].settling_time.worst);
+    }
+}
+
+// Test 3: Common random numbers shrink the scatter of candidate differences
+TEST(MonteCarloTest, CommonRandomNumbersReduceVariance)
+{
+    MissionProfile mission = shortMission();
+    mission.noise.amplitude = 2.0;
+    MonteCarloConfig config;
+    config.samples = 32;
+    config.threads = 2;
+    std::vector<PIDGains> candidates = {{0.6, 0.01, 0.05}, {0.65, 0.01, 0.05}};
+
+    double common = runMonteCarlo(candidates, mission, config)[1].rmse_delta.variance;
+    config.common_random_numbers = false;
+    double independent = runMonteCarlo(candidates, mission, config)[1].rmse_delta.variance;
+    EXPECT_LT(common * 10.0, independent);
+}
+
+// Test 4: Plant draws stay inside the configured spread
+TEST(MonteCarloTest, PerturbationsStayInRange)
+{
+    MissionProfile mission = shortMission();
+    mission.plant.type = PlantType::Vehicle;
+    MonteCarloConfig config;
+    config.perturbation.mass = 0.2;
+    config.perturbation.noise = 0.5;
+
+    bool varied = false;
+    for (int s = 0; s < 50; s++)
+    {
+        MissionProfile sample = monteCarloSample(mission, config, s, 0);
+        EXPECT_GE(sample.plant.vehicle.mass, 0.8 * mission.plant.vehicle.mass);
+        EXPECT_LT(sample.plant.vehicle.mass, 1.2 * mission.plant.vehicle.mass);
+        EXPECT_GE(sample.noise.amplitude, 0.5 * mission.noise.amplitude);
+        EXPECT_EQ(sample.plant.vehicle.drag, mission.plant.vehicle.drag);
+        varied |= (sample.plant.vehicle.mass != mission.plant.vehicle.mass);
+    }
+    EXPECT_TRUE(varied);
+
+    MissionProfile a = monteCarloSample(mission, config, 3, 0);
+    MissionProfile b = monteCarloSample(mission, config, 3, 7);
+    EXPECT_EQ(a.noise.seed, b.noise.seed); // Common random numbers ignore the candidate
+    config.common_random_numbers = false;
+    EXPECT_NE(monteCarloSample(mission, config, 3, 7).noise.seed, a.noise.seed);
+}
+
+// Test 5: Without samples every candidate still reports its own gains
+TEST(MonteCarloTest, NoSamplesKeepsGains)
+{
+    MonteCarloConfig config;
+    config.samples = 0;
+    std::vector<MonteCarloResult> results = runMonteCarlo({{0.6, 0.01, 0.05}, {1.2, 0.0, 0.1}}, shortMission(), config);
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[1].gains.kp, 1.2);
+    EXPECT_EQ(results[1].gains.kd, 0.1);
+    EXPECT_EQ(results[1].unsettled, 0);
+}
+
+// Test 6: Spreads that could draw a non-positive mass or time constant are rejected
+TEST(MonteCarloTest, RejectsOversizedSpreads)
+{
+    MonteCarloConfig config;
+    config.samples = 2;
+    config.perturbation.mass = 1.5;
+    EXPECT_THROW(runMonteCarlo({{0.6, 0.01, 0.05}}, shortMission(), config), std::invalid_argument);
+    config.perturbation.mass = 0.0;
+    config.perturbation.noise = -0.1;
+    EXPECT_THROW(runMonteCarlo({{0.6, 0.01, 0.05}}, shortMission(), config), std::invalid_argument);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include "Optimizers.hpp"
+
+namespace
+{
+    MissionProfile shortMission()
+    {
+        MissionProfile mission;
+        mission.steps = 300;
+        mission.switch_step = 100;
+        return mission;
+    }
+}
+
+// Test 1: Jacobi reproduces A = V diag(values) V^T with orthonormal V
+TEST(OptimizersTest, JacobiEigen3)
+{
+    const double a[3][3] = {{4.0, 1.0, -2.0}, {1.0, 3.0, 0.5}, {-2.0, 0.5, 5.0}};
+    double values[3], v[3][3];
+    jacobiEigen3(a, values, v);
+
+    for (int r = 0; r < 3; r++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            double rebuilt = 0.0, dot = 0.0;
+            for (int k = 0; k < 3; k++)
+            {
+                rebuilt += v[r][k] * values[k] * v[c][k];
+                dot += v[k][r] * v[k][c];
+            }
+            EXPECT_NEAR(rebuilt, a[r][c], 1e-12);
+            EXPECT_NEAR(dot, (r == c) ? 1.0 : 0.0, 1e-12);
+        }
+    }
+}
+
+// Test 2: With no bound the bounded batch matches simulateBatch; a tight bound stops lanes early
+TEST(OptimizersTest, BoundedBatchAbortsHopelessLanes)
+{
+    MissionProfile mission = shortMission();
+    std::vector<PIDGains> candidates = {{0.6, 0.01, 0.05}, {0.0, 0.0, 0.0}};
+    std::vector<MetricsSummary> full = simulateBatch(candidates, mission);
+
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<RunResult> open = simulateBatchBounded(candidates, mission, {inf, inf});
+    for (std::size_t c = 0; c < candidates.size(); c++)
+    {
+        EXPECT_EQ(open[c].status, RunStatus::Completed);
+        EXPECT_EQ(open[c].metrics.rmse, full[c].rmse);
+    }
+
+    // Zero gains never leave the ground, so their RMSE bound crosses 1.0 within a few samples
+    std::vector<RunResult> bounded = simulateBatchBounded(candidates, mission, {inf, 1.0});
+    EXPECT_EQ(bounded[0].status, RunStatus::Completed);
+    EXPECT_EQ(bounded[1].status, RunStatus::CostBound);
+    EXPECT_LT(bounded[1].steps, mission.steps);
+    EXPECT_GT(full[1].rmse, 1.0);
+}
+
+// Test 3: Every population method improves on the start point within its budget
+TEST(OptimizersTest, MethodsImproveOnStart)
+{
+    MissionProfile mission = shortMission();
+    const double start_cost = Tuner(mission, TunerConfig()).evaluate({0.5, 0.0, 0.0});
+
+    for (OptimizerMethod method : {OptimizerMethod::NelderMead, OptimizerMethod::DifferentialEvolution, OptimizerMethod::CmaEs})
+    {
+        OptimizerConfig config;
+        config.method = method;
+        config.max_evaluations = 200;
+        TuningResult result = optimizeGains(mission, config);
+
+        EXPECT_LT(result.cost, start_cost) << static_cast<int>(method);
+        EXPECT_LE(result.evaluations, config.max_evaluations + 16);
+        EXPECT_GE(result.gains.kp, 0.0);
+        EXPECT_GE(result.gains.ki, 0.0);
+        EXPECT_GE(result.gains.kd, 0.0);
+
+        // The reported cost is reproducible by a plain run
+        EXPECT_DOUBLE_EQ(Tuner(mission, TunerConfig()).evaluate(result.gains), result.cost);
+    }
+}
+
+// Test 4: Sharding a generation across threads does not change the result
+TEST(OptimizersTest, ThreadCountIndependent)
+{
+    OptimizerConfig config;
+    config.method = OptimizerMethod::DifferentialEvolution;
+    config.max_evaluations = 96;
+
+    TuningResult serial = optimizeGains(shortMission(), config);
+    config.threads = 3;
+    TuningResult parallel = optimizeGains(shortMission(), config);
+
+    EXPECT_EQ(serial.cost, parallel.cost);
+    EXPECT_EQ(serial.gains.kp, parallel.gains.kp);
+    EXPECT_EQ(serial.aborted, parallel.aborted);
+}
+
+// Test 5: Method names
+TEST(OptimizersTest, ParseMethod)
+{
+    OptimizerMethod method;
+    EXPECT_TRUE(parseOptimizerMethod("cmaes", method));
+    EXPECT_EQ(method, OptimizerMethod::CmaEs);
+    EXPECT_TRUE(parseOptimizerMethod("nelder-mead", method));
+    EXPECT_EQ(method, OptimizerMethod::NelderMead);
+    EXPECT_FALSE(parseOptimizerMethod("annealing", method));
+}
+
+// Test 6: CMA-ES weights its mu best samples, so none of them may be cut short by a cost bound
+TEST(OptimizersTest, CmaEsDoesNotBoundCandidates)
+{
+    OptimizerConfig config;
+    config.method = OptimizerMethod::CmaEs;
+    config.max_evaluations = 160;
+    config.limits = RunLimits(); // No divergence limits either: only a cost bound could stop a run
+
+    TuningResult result = optimizeGains(shortMission(), config);
+    EXPECT_EQ(result.aborted, 0);
+    EXPECT_GE(result.evaluations, config.max_evaluations);
+}
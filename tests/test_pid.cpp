@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
 #include "PID.hpp"
 
 // Test 1: Does the PID output zero if error is zero?
@@ -23,4 +25,65 @@ TEST(PIDTest, MaxOutputLimit)
     PID pid(1000.0, 0.0, 0.0, 0.1, 50.0, -50.0);
     // Huge error, but output should be capped at 50.0
     EXPECT_EQ(pid.calculate(100.0, 0.0), 50.0);
-}
\ No newline at end of file
+}
+
+// Test 4: Default options reproduce the plain controller exactly
+TEST(PIDTest, DefaultOptionsAreBitIdentical)
+{
+    PID plain(0.6, 0.01, 0.05, 0.1, 500.0, -500.0);
+    PID optioned(0.6, 0.01, 0.05, 0.1, 500.0, -500.0, PIDOptions());
+    for (int i = 0; i < 300; i++)
+    {
+        double pv = (i * 37 % 101) - 50.0;
+        ASSERT_EQ(plain.calculate(20.0, pv), optioned.calculate(20.0, pv));
+    }
+}
+
+// Test 5: The derivative filter smooths noise; derivative-on-measurement ignores setpoint steps
+TEST(PIDTest, DerivativeFilterAndMeasurement)
+{
+    PIDOptions filtered_options;
+    filtered_options.derivative_filter = 0.5;
+    PID raw(0.0, 0.0, 1.0, 0.1, 1e9, -1e9);
+    PID filtered(0.0, 0.0, 1.0, 0.1, 1e9, -1e9, filtered_options);
+
+    double raw_peak = 0.0, filtered_peak = 0.0;
+    for (int i = 0; i < 100; i++)
+    {
+        double noise = (i % 2) ? 0.5 : -0.5; // Worst case: alternating noise
+        raw_peak = std::max(raw_peak, std::abs(raw.calculate(0.0, noise)));
+        filtered_peak = std::max(filtered_peak, std::abs(filtered.calculate(0.0, noise)));
+    }
+    EXPECT_LT(filtered_peak, raw_peak / 4.0);
+
+    PIDOptions measurement_options;
+    measurement_options.derivative_on_measurement = true;
+    PID on_error(0.0, 0.0, 1.0, 0.1, 1e9, -1e9);
+    PID on_measurement(0.0, 0.0, 1.0, 0.1, 1e9, -1e9, measurement_options);
+    on_error.calculate(10.0, 5.0);
+    on_measurement.calculate(10.0, 5.0);
+    EXPECT_DOUBLE_EQ(on_error.calculate(50.0, 5.0), 400.0); // Setpoint kick: 40 / 0.1
+    EXPECT_EQ(on_measurement.calculate(50.0, 5.0), 0.0);    // pv did not move
+}
+
+// Test 6: Both anti-windup modes stop the integrator from charging at the limit
+TEST(PIDTest, AntiWindup)
+{
+    auto overshoot = [](AntiWindup mode) {
+        PIDOptions options;
+        options.anti_windup = mode;
+        PID pid(0.5, 0.5, 0.0, 0.1, 5.0, -5.0, options);
+        double z = 0.0, peak = 0.0;
+        for (int i = 0; i < 600; i++)
+        {
+            z += pid.calculate(50.0, z) * 0.1;
+            peak = std::max(peak, z);
+        }
+        return peak - 50.0;
+    };
+
+    double none = overshoot(AntiWindup::None);
+    EXPECT_GT(none, 30.0);
+    EXPECT_LT(overshoot(AntiWindup::Conditional), none / 5.0);
+    EXPECT_LT(overshoot(AntiWindup::BackCalculation), none / 5.0);
+}
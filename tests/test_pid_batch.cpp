@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "PID.hpp"
+#include "PIDBatch.hpp"
+
+// Test 1: The three PIDTest expectations hold in every lane at once
+TEST(PIDBatchTest, PIDTestExpectationsPerLane)
+{
+    // Lanes: zero error, proportional action, saturation (repeated to cover the vector tail)
+    const std::size_t lanes = 7;
+    PIDBatch batch(lanes, 0.1, 50.0, -50.0);
+    std::vector<double> setpoint(lanes), pv(lanes), out(lanes);
+    for (std::size_t i = 0; i < lanes; i++)
+    {
+        switch (i % 3)
+        {
+        case 0: batch.setGains(i, 1.0, 0.1, 0.01); setpoint[i] = 10.0; pv[i] = 10.0; break;
+        case 1: batch.setGains(i, 2.0, 0.0, 0.0); setpoint[i] = 10.0; pv[i] = 5.0; break;
+        default: batch.setGains(i, 1000.0, 0.0, 0.0); setpoint[i] = 100.0; pv[i] = 0.0; break;
+        }
+    }
+
+    batch.calculate(setpoint.data(), pv.data(), out.data());
+    for (std::size_t i = 0; i < lanes; i++)
+    {
+        switch (i % 3)
+        {
+        case 0: EXPECT_NEAR(out[i], 0.0, 0.001); break;
+        case 1: EXPECT_NEAR(out[i], 10.0, 0.001); break;
+        default: EXPECT_EQ(out[i], 50.0); break;
+        }
+    }
+}
+
+// Test 2: Every lane is bit-identical to a scalar PID over a long random run
+TEST(PIDBatchTest, BitIdenticalToScalarPID)
+{
+    const std::size_t lanes = 11;
+    const double dt = 0.1;
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> gain(0.0, 3.0), value(-200.0, 200.0);
+
+    PIDBatch batch(lanes, dt, 500.0, -500.0);
+    std::vector<PID> reference;
+    for (std::size_t i = 0; i < lanes; i++)
+    {
+        double kp = gain(rng), ki = gain(rng) * 0.1, kd = gain(rng) * 0.1;
+        batch.setGains(i, kp, ki, kd);
+        reference.emplace_back(kp, ki, kd, dt, 500.0, -500.0);
+    }
+
+    std::vector<double> setpoint(lanes), pv(lanes), out(lanes);
+    for (int step = 0; step < 1000; step++)
+    {
+        for (std::size_t i = 0; i < lanes; i++)
+        {
+            setpoint[i] = value(rng);
+            pv[i] = value(rng);
+        }
+        batch.calculate(setpoint.data(), pv.data(), out.data());
+
+        for (std::size_t i = 0; i < lanes; i++)
+        {
+            double expected = reference[i].calculate(setpoint[i], pv[i]);
+            ASSERT_EQ(std::memcmp(&expected, &out[i], sizeof(double)), 0) << "lane " << i << " step " << step;
+        }
+    }
+}
+
+// Test 3: reset() clears the integral in every lane
+TEST(PIDBatchTest, ResetClearsState)
+{
+    PIDBatch batch(2, 0.1, 100.0, -100.0);
+    batch.setGains(0, 0.0, 1.0, 0.0);
+    batch.setGains(1, 0.0, 1.0, 0.0);
+    double setpoint[2] = {10.0, 10.0}, pv[2] = {0.0, 0.0}, out[2];
+
+    batch.calculate(setpoint, pv, out);
+    batch.calculate(setpoint, pv, out);
+    EXPECT_NEAR(out[0], 2.0, 1e-12);
+
+    batch.reset();
+    batch.calculate(setpoint, pv, out);
+    EXPECT_NEAR(out[1], 1.0, 1e-12);
+}
+
+// Test 4: With every option combination, lanes still match the scalar PID bit for bit
+TEST(PIDBatchTest, OptionsBitIdenticalToScalarPID)
+{
+    const std::size_t lanes = 9; // Covers the vector body and the scalar tail
+    const double dt = 0.05;
+    for (int combo = 0; combo < 12; combo++)
+    {
+        PIDOptions options;
+        options.derivative_filter = (combo & 1) ? 0.2 : 0.0;
+        options.derivative_on_measurement = (combo & 2) != 0;
+        options.anti_windup = static_cast<AntiWindup>(combo / 4);
+        options.back_calculation_gain = 2.0;
+
+        std::mt19937_64 rng(combo);
+        std::uniform_real_distribution<double> gain(0.0, 3.0), value(-200.0, 200.0);
+        PIDBatch batch(lanes, dt, 50.0, -50.0, options);
+        std::vector<PID> reference;
+        for (std::size_t i = 0; i < lanes; i++)
+        {
+            double kp = gain(rng), ki = (i == 3) ? 0.0 : gain(rng), kd = gain(rng) * 0.1;
+            batch.setGains(i, kp, ki, kd);
+            reference.emplace_back(kp, ki, kd, dt, 50.0, -50.0, options);
+        }
+
+        std::vector<double> setpoint(lanes), pv(lanes), out(lanes);
+        for (int step = 0; step < 400; step++)
+        {
+            for (std::size_t i = 0; i < lanes; i++)
+            {
+                setpoint[i] = value(rng);
+                pv[i] = value(rng);
+            }
+            batch.calculate(setpoint.data(), pv.data(), out.data());
+
+            for (std::size_t i = 0; i < lanes; i++)
+            {
+                double expected = reference[i].calculate(setpoint[i], pv[i]);
+                ASSERT_EQ(std::memcmp(&expected, &out[i], sizeof(double)), 0)
+                    << "combo " << combo << " lane " << i << " step " << step;
+            }
+        }
+    }
+}
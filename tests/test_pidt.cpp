@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include "ControlLoop.hpp"
+#include "PID.hpp"
+#include "PIDT.hpp"
+#include "Simulation.hpp"
+
+namespace
+{
+    struct Proportional
+    {
+        static constexpr double kp = 2.0, ki = 0.0, kd = 0.0;
+        static constexpr double dt = 0.1, max_output = 100.0, min_output = -100.0;
+    };
+
+    struct Saturating
+    {
+        static constexpr double kp = 1000.0, ki = 0.0, kd = 0.0;
+        static constexpr double dt = 0.1, max_output = 50.0, min_output = -50.0;
+    };
+
+    struct AltitudeHold
+    {
+        static constexpr double kp = 0.6, ki = 0.01, kd = 0.05;
+        static constexpr double dt = 0.1, max_output = 500.0, min_output = -500.0;
+    };
+}
+
+static_assert(is_controller_v<PID>, "PID must satisfy the controller interface");
+static_assert(is_controller_v<PIDT<AltitudeHold>>, "PIDT must satisfy the controller interface");
+static_assert(!is_controller_v<MockSensor>, "A sensor is not a controller");
+
+// Test 1: Same expectations as PIDTest, now resolved at compile time
+TEST(PIDTTest, ProportionalAndLimit)
+{
+    PIDT<Proportional> p;
+    EXPECT_NEAR(p.calculate(10.0, 5.0), 10.0, 0.001);
+
+    PIDT<Saturating> sat;
+    EXPECT_EQ(sat.calculate(100.0, 0.0), 50.0);
+}
+
+// Test 2: Tracks the runtime PID over a whole mission (only rounding differs)
+TEST(PIDTTest, MatchesRuntimePID)
+{
+    MissionProfile mission;
+    PID runtime(AltitudeHold::kp, AltitudeHold::ki, AltitudeHold::kd, AltitudeHold::dt, 500.0, -500.0);
+    PIDT<AltitudeHold> fixed;
+
+    MetricsSummary a = runControlLoop(runtime, mission);
+    MetricsSummary b = runControlLoop(fixed, mission);
+    EXPECT_NEAR(a.rmse, b.rmse, 1e-6);
+    EXPECT_NEAR(a.overshoot_percent, b.overshoot_percent, 1e-6);
+}
+
+// Test 3: float instantiation stays close to double, reset() clears the state
+TEST(PIDTTest, FloatVariantAndReset)
+{
+    PIDT<AltitudeHold, float> f;
+    PIDT<AltitudeHold, double> d;
+    for (int i = 0; i < 100; i++)
+        EXPECT_NEAR(f.calculate(100.0f, i * 0.5f), d.calculate(100.0, i * 0.5), 1e-3);
+
+    f.reset();
+    PIDT<AltitudeHold, float> fresh;
+    EXPECT_EQ(f.calculate(10.0f, 0.0f), fresh.calculate(10.0f, 0.0f));
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "MockSensor.hpp"
+#include "Plant.hpp"
+#include "Simulation.hpp"
+
+namespace
+{
+    PlantConfig vehicleConfig(IntegratorMethod method)
+    {
+        PlantConfig config;
+        config.type = PlantType::Vehicle;
+        config.integrator = method;
+        return config;
+    }
+
+    // Unpowered fall from 1 km with drag, 5 s
+    double fallAltitude(IntegratorMethod method, double dt)
+    {
+        PlantConfig config = vehicleConfig(method);
+        config.vehicle.max_thrust = 0.0;
+        VehiclePlant plant(config, 1000.0);
+        const int steps = static_cast<int>(std::lround(5.0 / dt));
+        for (int i = 0; i < steps; i++)
+            plant.step(0.0, dt);
+        return plant.altitude();
+    }
+}
+
+// Test 1: The integrator plant is the original MockSensor physics, bit for bit
+TEST(PlantTest, IntegratorMatchesSensorUpdate)
+{
+    SensorNoise quiet;
+    quiet.amplitude = 0.0;
+    IntegratorPlant plant(3.0);
+    MockSensor legacy(3.0, quiet);
+    for (int i = 0; i < 500; i++)
+    {
+        const double command = 40.0 * std::sin(0.1 * i);
+        plant.step(command, 0.1);
+        legacy.update(command * 0.1);
+        ASSERT_EQ(plant.altitude(), legacy.readValue()) << "step " << i;
+    }
+}
+
+// Test 2: A zero command is the hover trim, so the vehicle holds altitude
+TEST(PlantTest, VehicleHoversOnZeroCommand)
+{
+    VehiclePlant plant(vehicleConfig(IntegratorMethod::RK4), 25.0);
+    for (int i = 0; i < 1000; i++)
+        plant.step(0.0, 0.1);
+    EXPECT_EQ(plant.altitude(), 25.0);
+    EXPECT_EQ(plant.velocity(), 0.0);
+
+    plant.step(100.0, 0.1);
+    EXPECT_GT(plant.velocity(), 0.0); // Positive command climbs
+}
+
+// Test 3: RK4 converges at 4th order, semi-implicit Euler at 1st
+TEST(PlantTest, IntegratorConvergenceOrder)
+{
+    const double reference = fallAltitude(IntegratorMethod::RK4, 1e-4);
+
+    double rk4_coarse = std::abs(fallAltitude(IntegratorMethod::RK4, 0.1) - reference);
+    double rk4_fine = std::abs(fallAltitude(IntegratorMethod::RK4, 0.05) - reference);
+    double euler_coarse = std::abs(fallAltitude(IntegratorMethod::SemiImplicitEuler, 0.1) - reference);
+    double euler_fine = std::abs(fallAltitude(IntegratorMethod::SemiImplicitEuler, 0.05) - reference);
+
+    EXPECT_GT(rk4_coarse / rk4_fine, 10.0);  // ~16 for 4th order
+    EXPECT_GT(euler_coarse / euler_fine, 1.5); // ~2 for 1st order
+    EXPECT_LT(rk4_coarse, euler_coarse / 100.0);
+}
+
+// Test 4: The ground stops a descent
+TEST(PlantTest, GroundContact)
+{
+    VehiclePlant plant(vehicleConfig(IntegratorMethod::SemiImplicitEuler), 1.0);
+    for (int i = 0; i < 200; i++)
+        plant.step(-500.0, 0.1);
+    EXPECT_EQ(plant.altitude(), 0.0);
+    EXPECT_EQ(plant.velocity(), 0.0);
+    EXPECT_GE(plant.thrust(), 0.0);
+}
+
+// Test 5: PlantBatch lanes match the scalar plant bit for bit
+TEST(PlantTest, BatchMatchesScalar)
+{
+    for (IntegratorMethod method : {IntegratorMethod::SemiImplicitEuler, IntegratorMethod::RK4})
+    {
+        const std::size_t n = 7;
+        PlantConfig config = vehicleConfig(method);
+        PlantBatch batch(n, config, 10.0);
+        std::vector<VehiclePlant> scalar(n, VehiclePlant(config, 10.0));
+        std::vector<double> command(n);
+
+        for (int i = 0; i < 300; i++)
+        {
+            for (std::size_t l = 0; l < n; l++)
+                command[l] = 80.0 * std::sin(0.05 * i + l);
+            batch.step(command.data(), 0.1);
+            for (std::size_t l = 0; l < n; l++)
+            {
+                scalar[l].step(command[l], 0.1);
+                ASSERT_EQ(batch.altitude(l), scalar[l].altitude()) << "lane " << l << " step " << i;
+                ASSERT_EQ(batch.velocity(l), scalar[l].velocity()) << "lane " << l << " step " << i;
+            }
+        }
+    }
+}
+
+// Test 6: The vehicle plant flows through the batch and scalar simulations alike
+TEST(PlantTest, VehicleMissionBatchMatchesScalar)
+{
+    MissionProfile mission;
+    mission.plant = vehicleConfig(IntegratorMethod::RK4);
+    std::vector<PIDGains> candidates = {{8.0, 0.05, 25.0}, {4.0, 0.0, 15.0}, {0.6, 0.01, 0.05}};
+
+    std::vector<MetricsSummary> batch = simulateBatch(candidates, mission);
+    for (std::size_t c = 0; c < candidates.size(); c++)
+    {
+        MetricsSummary scalar = simulateMetrics(candidates[c], mission);
+        EXPECT_EQ(batch[c].rmse, scalar.rmse) << "candidate " << c;
+        EXPECT_EQ(batch[c].settling_time, scalar.settling_time) << "candidate " << c;
+    }
+
+    // Same gains, different physics
+    MissionProfile integrator = mission;
+    integrator.plant.type = PlantType::Integrator;
+    EXPECT_NE(simulateMetrics(candidates[0], integrator).rmse, batch[0].rmse);
+}
+
+// Test 7: N substeps of one control step are N steps at dt / N
+TEST(PlantTest, SubstepsMatchFinerSteps)
+{
+    PlantConfig config = vehicleConfig(IntegratorMethod::SemiImplicitEuler);
+    config.substeps = 4;
+    VehiclePlant substepped(config, 5.0);
+    config.substeps = 1;
+    VehiclePlant fine(config, 5.0);
+
+    for (int i = 0; i < 100; i++)
+    {
+        const double command = 60.0 * std::sin(0.2 * i);
+        substepped.step(command, 0.1);
+        for (int s = 0; s < 4; s++)
+            fine.step(command, 0.025);
+        ASSERT_EQ(substepped.altitude(), fine.altitude()) << "step " << i;
+        ASSERT_EQ(substepped.velocity(), fine.velocity()) << "step " << i;
+    }
+}
+
+// Test 8: Substepping a coarse control rate brings Euler towards the exact answer
+TEST(PlantTest, SubstepsImproveAccuracy)
+{
+    const double reference = fallAltitude(IntegratorMethod::RK4, 1e-4);
+
+    auto fall = [](int substeps) {
+        PlantConfig config = vehicleConfig(IntegratorMethod::SemiImplicitEuler);
+        config.vehicle.max_thrust = 0.0;
+        config.substeps = substeps;
+        VehiclePlant plant(config, 1000.0);
+        for (int i = 0; i < 50; i++)
+            plant.step(0.0, 0.1);
+        return plant.altitude();
+    };
+
+    double coarse = std::abs(fall(1) - reference);
+    double substepped = std::abs(fall(100) - reference); // 1 kHz physics under a 10 Hz controller
+    EXPECT_LT(substepped, coarse / 50.0);
+}
+
+// Test 9: Batched lanes substep like the scalar plant, and telemetry stays at the control rate
+TEST(PlantTest, SubstepsInBatchAndMission)
+{
+    MissionProfile mission;
+    mission.steps = 400;
+    mission.switch_step = 200;
+    mission.plant = vehicleConfig(IntegratorMethod::RK4);
+    mission.plant.substeps = 10;
+    std::vector<PIDGains> candidates = {{8.0, 0.05, 25.0}, {4.0, 0.0, 15.0}};
+
+    std::vector<MetricsSummary> batch = simulateBatch(candidates, mission);
+    for (std::size_t c = 0; c < candidates.size(); c++)
+        EXPECT_EQ(batch[c].rmse, simulateMetrics(candidates[c], mission).rmse) << "candidate " << c;
+
+    MissionTrace trace = simulate(candidates[0], mission);
+    EXPECT_EQ(trace.actual.size(), 400u);
+
+    MissionProfile single = mission;
+    single.plant.substeps = 1;
+    EXPECT_NE(simulateMetrics(candidates[0], single).rmse, batch[0].rmse);
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "RealTimeScheduler.hpp"
+
+// Test 1: The loop runs at the requested rate without drifting
+TEST(RealTimeSchedulerTest, HoldsRate)
+{
+    RealTimeConfig config;
+    config.rate_hz = 1000.0;
+    RealTimeScheduler scheduler(config);
+
+    auto begin = std::chrono::steady_clock::now();
+    scheduler.start();
+    for (int i = 0; i < 50; i++)
+        scheduler.waitNextTick();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    EXPECT_EQ(scheduler.stats().ticks, 50u);
+    EXPECT_EQ(scheduler.stats().wakeup_latency.count(), 50u);
+    EXPECT_GE(elapsed, 0.050 - 0.001);
+}
+
+// Test 2: Work longer than a period is reported as deadline misses
+TEST(RealTimeSchedulerTest, CountsDeadlineMisses)
+{
+    RealTimeConfig config;
+    config.rate_hz = 1000.0;
+    RealTimeScheduler scheduler(config);
+
+    scheduler.start();
+    scheduler.waitNextTick();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5)); // Overrun ~4-5 deadlines
+    scheduler.waitNextTick();
+
+    EXPECT_GE(scheduler.stats().deadline_misses, 3u);
+    EXPECT_EQ(scheduler.stats().tick_duration.count(), 1u);
+}
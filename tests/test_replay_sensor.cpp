@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "PID.hpp"
+#include "ReplaySensor.hpp"
+#include "Simulation.hpp"
+#include "Telemetry.hpp"
+
+static void record(TelemetryWriter &writer, const MissionTrace &trace)
+{
+    for (std::size_t i = 0; i < trace.time.size(); i++)
+        writer.write({trace.time[i], trace.target[i], trace.actual[i], trace.output[i]});
+    writer.close();
+}
+
+// Test 1: A float64 recording is served in place and replays through PID bit for bit
+TEST(ReplaySensorTest, Float64ReplayIsExact)
+{
+    const std::string path = "test_replay64.bin";
+    MissionProfile mission;
+    PIDGains gains = {0.6, 0.01, 0.05};
+    MissionTrace trace = simulate(gains, mission);
+    BinaryTelemetryWriter writer(path, mission.dt, mission.steps);
+    record(writer, trace);
+
+    ReplaySensor sensor(path);
+    EXPECT_EQ(sensor.format(), ReplayFormat::Float64);
+    EXPECT_EQ(sensor.size(), static_cast<std::size_t>(mission.steps));
+    EXPECT_EQ(sensor.dt(), mission.dt);
+    ASSERT_NE(sensor.column(2), nullptr);
+    EXPECT_EQ(sensor.column(2)[10], trace.actual[10]);
+
+    PID pid(gains.kp, gains.ki, gains.kd, mission.dt, mission.max_output, mission.min_output);
+    ReplayReport report = replayController(pid, sensor);
+    EXPECT_EQ(report.samples, static_cast<std::size_t>(mission.steps));
+    EXPECT_EQ(report.max_error, 0.0);
+    EXPECT_EQ(report.mismatches, 0u);
+
+    // Different gains are caught
+    PID other(0.7, 0.01, 0.05, mission.dt, mission.max_output, mission.min_output);
+    EXPECT_GT(replayController(other, sensor).mismatches, 0u);
+    std::remove(path.c_str());
+}
+
+// Test 2: CSV is parsed straight from the mapping, rows and dt included
+TEST(ReplaySensorTest, CsvRows)
+{
+    const std::string path = "test_replay.csv";
+    {
+        std::ofstream file(path);
+        file << "Time,Target,Actual,Output\n0,50,1.5,20\n0.1,50,2.25,19.5\r\n0.2,100,3,-4"; // No final newline
+    }
+
+    ReplaySensor sensor(path);
+    EXPECT_EQ(sensor.format(), ReplayFormat::Csv);
+    EXPECT_EQ(sensor.size(), 3u);
+    EXPECT_DOUBLE_EQ(sensor.dt(), 0.1);
+    EXPECT_EQ(sensor.column(0), nullptr);
+
+    EXPECT_EQ(sensor.read(), 1.5);
+    EXPECT_EQ(sensor.readValue(), 2.25);
+    EXPECT_EQ(sensor.record().output, 19.5);
+    EXPECT_EQ(sensor.read(), 3.0);
+    EXPECT_EQ(sensor.record().target, 100.0);
+    EXPECT_TRUE(sensor.exhausted());
+    EXPECT_EQ(sensor.read(), 3.0); // Holds the last sample
+
+    sensor.init();
+    EXPECT_EQ(sensor.read(), 1.5);
+    std::remove(path.c_str());
+}
+
+// Test 3: Float32 files and burst reads with the recorded timestamps
+TEST(ReplaySensorTest, Float32ReadBatch)
+{
+    const std::string path = "test_replay32.bin";
+    {
+        BinaryTelemetryWriter writer(path, 0.1, 5, TelemetryPrecision::Float32);
+        for (int i = 0; i < 5; i++)
+            writer.write({i * 0.1, 50.0, i / 3.0, 1.0});
+    }
+
+    ReplaySensor sensor(path);
+    EXPECT_EQ(sensor.format(), ReplayFormat::Float32);
+    std::vector<double> values(8), times(8);
+    EXPECT_EQ(sensor.readBatch(values.data(), times.data(), 3), 3u);
+    EXPECT_EQ(values[2], static_cast<double>(static_cast<float>(2 / 3.0)));
+    EXPECT_EQ(times[1], static_cast<double>(0.1f));
+    EXPECT_EQ(sensor.readBatch(values.data(), nullptr, 8), 2u); // Only what is left
+    EXPECT_EQ(sensor.readBatch(values.data(), nullptr, 8), 0u);
+    std::remove(path.c_str());
+}
+
+// Test 4: Missing files and foreign content are rejected
+TEST(ReplaySensorTest, RejectsForeignFiles)
+{
+    EXPECT_THROW(ReplaySensor("does_not_exist.csv"), std::runtime_error);
+
+    const std::string path = "test_replay_foreign.txt";
+    {
+        std::ofstream file(path);
+        file << "hello\n";
+    }
+    EXPECT_THROW(ReplaySensor sensor(path), std::runtime_error);
+    {
+        std::ofstream file(path);
+        file << "Time,Target,Actual,Output\n0,50,abc,1\n";
+    }
+    EXPECT_THROW(ReplaySensor sensor(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+// Test 5: Blank and whitespace-only lines are not rows
+TEST(ReplaySensorTest, CsvSkipsBlankLines)
+{
+    const std::string path = "test_replay_blank.csv";
+    {
+        std::ofstream file(path);
+        file << "Time,Target,Actual,Output\n\n0,50,1.5,20\n \t\r\n0.1,50,2.25,19.5\n\n";
+    }
+
+    ReplaySensor sensor(path);
+    EXPECT_EQ(sensor.size(), 2u);
+    EXPECT_DOUBLE_EQ(sensor.dt(), 0.1);
+    EXPECT_EQ(sensor.read(), 1.5);
+    EXPECT_EQ(sensor.read(), 2.25);
+    EXPECT_TRUE(sensor.exhausted());
+    std::remove(path.c_str());
+}
+
+// Test 6: A binary header whose size would misalign the columns is not telemetry
+TEST(ReplaySensorTest, RejectsMisalignedHeader)
+{
+    const std::string path = "test_replay_misaligned.bin";
+    {
+        BinaryTelemetryWriter writer(path, 0.1, 4);
+        for (int i = 0; i < 4; i++)
+            writer.write({i * 0.1, 50.0, 1.0, 1.0});
+    }
+    std::vector<char> image;
+    {
+        std::ifstream file(path, std::ios::binary);
+        image.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    BinaryTelemetryLayout layout;
+    ASSERT_TRUE(parseBinaryTelemetryHeader(image.data(), image.size(), layout));
+
+    // Grow header_size by one byte and shift the columns along with it
+    std::uint32_t header_size = 0;
+    const std::size_t offset = 20; // magic[8], version, value_size, column_count, then header_size
+    std::memcpy(&header_size, image.data() + offset, sizeof(header_size));
+    header_size++;
+    std::memcpy(image.data() + offset, &header_size, sizeof(header_size));
+    image.insert(image.begin() + layout.header_size, '\0');
+    EXPECT_FALSE(parseBinaryTelemetryHeader(image.data(), image.size(), layout));
+    std::remove(path.c_str());
+}
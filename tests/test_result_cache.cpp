@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <string>
+#include <sys/stat.h>
+#include "ResultCache.hpp"
+#include "Simulation.hpp"
+#include "Tuner.hpp"
+
+// Test 1: Keys change with every input that changes the result
+TEST(ResultCacheTest, KeyCoversInputs)
+{
+    PIDGains gains = {0.6, 0.01, 0.05};
+    MissionProfile mission;
+    const SimulationKey base = makeSimulationKey(gains, mission);
+    EXPECT_EQ(base.hash, makeSimulationKey(gains, mission).hash);
+
+    MissionProfile seeded = mission;
+    seeded.noise.seed = 2;
+    EXPECT_NE(base.hash, makeSimulationKey(gains, seeded).hash);
+
+    MissionProfile longer = mission;
+    longer.steps = 1001;
+    EXPECT_NE(base.hash, makeSimulationKey(gains, longer).hash);
+
+    EXPECT_NE(base.hash, makeSimulationKey({0.6, 0.01, 0.0500001}, mission).hash);
+}
+
+// Test 2: The LRU evicts the least recently used entry
+TEST(ResultCacheTest, LruEviction)
+{
+    MissionProfile mission;
+    SimulationKey a = makeSimulationKey({1, 0, 0}, mission);
+    SimulationKey b = makeSimulationKey({2, 0, 0}, mission);
+    SimulationKey c = makeSimulationKey({3, 0, 0}, mission);
+
+    LruCache<int> cache(2);
+    cache.insert(a, 1);
+    cache.insert(b, 2);
+    ASSERT_NE(cache.find(a), nullptr); // a is now the most recent
+    cache.insert(c, 3);
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(*cache.find(a), 1);
+    EXPECT_EQ(cache.find(b), nullptr);
+    EXPECT_EQ(*cache.find(c), 3);
+
+    // Same hash, different bytes: a miss, never a wrong answer
+    SimulationKey forged = a;
+    forged.bytes[0] ^= 1;
+    EXPECT_EQ(cache.find(forged), nullptr);
+}
+
+// Test 3: A disk-backed cache serves a fresh process
+TEST(ResultCacheTest, DiskStoreSurvivesInstances)
+{
+    char pattern[] = "/tmp/aerostream_cacheXXXXXX";
+    ASSERT_NE(mkdtemp(pattern), nullptr);
+    const std::string dir = pattern;
+
+    PIDGains gains = {0.6, 0.01, 0.05};
+    MissionProfile mission;
+    SimulationKey key = makeSimulationKey(gains, mission);
+    MetricsSummary metrics = simulateMetrics(gains, mission);
+
+    {
+        ResultCache writer(16, dir);
+        writer.store(key, metrics);
+    }
+
+    ResultCache reader(16, dir);
+    MetricsSummary loaded;
+    ASSERT_TRUE(reader.find(key, loaded));
+    EXPECT_EQ(loaded.rmse, metrics.rmse);
+    EXPECT_EQ(loaded.settling_time, metrics.settling_time);
+    EXPECT_EQ(loaded.samples, metrics.samples);
+    EXPECT_EQ(reader.stats().disk_hits, 1u);
+
+    ASSERT_TRUE(reader.find(key, loaded)); // Now from memory
+    EXPECT_EQ(reader.stats().hits, 1u);
+
+    std::system(("rm -rf " + dir).c_str());
+}
+
+// Test 4: Re-running a tune against a shared cache only re-flies the runs that were cut short
+TEST(ResultCacheTest, RepeatedTuneHitsCache)
+{
+    MissionProfile mission;
+    ResultCache shared;
+    TunerConfig config;
+    config.cache = &shared;
+
+    TuningResult first = Tuner(mission, config).run();
+    TuningResult second = Tuner(mission, config).run();
+
+    EXPECT_GT(first.evaluations, 0);
+    EXPECT_EQ(second.evaluations, first.aborted); // Partial runs are never cached
+    EXPECT_EQ(second.cache_hits, first.evaluations - first.aborted + first.cache_hits);
+    EXPECT_EQ(second.cost, first.cost);
+    EXPECT_EQ(second.gains.kp, first.gains.kp);
+}
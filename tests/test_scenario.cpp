@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include "Scenario.hpp"
+#include "Simulation.hpp"
+
+// Test 1: The default mission compiled into tables flies bit-identically
+TEST(ScenarioTest, MissionTablesMatchSimulation)
+{
+    MissionProfile mission;
+    PIDGains gains = {0.6, 0.01, 0.05};
+    Scenario scenario = scenarioFromMission(mission);
+
+    MetricsSummary expected = simulateMetrics(gains, mission);
+    MetricsSummary actual = runScenario(gains, scenario);
+    EXPECT_EQ(actual.rmse, expected.rmse);
+    EXPECT_EQ(actual.overshoot_percent, expected.overshoot_percent);
+    EXPECT_EQ(actual.settling_time, expected.settling_time);
+    EXPECT_EQ(actual.samples, expected.samples);
+
+    // The same mission written as a file gives the same result too
+    std::istringstream text("hold 500 50\nhold 500 100\n");
+    EXPECT_EQ(runScenario(gains, parseScenarios(text)[0]).rmse, expected.rmse);
+}
+
+// Test 2: Segments, ramps and disturbances compile into per-step tables
+TEST(ScenarioTest, CompilesSegments)
+{
+    std::istringstream text("scenario a   # first\n"
+                            "initial 10\n"
+                            "noise gaussian 0.2 9\n"
+                            "ramp 4 50\n"
+                            "hold 3 50\n"
+                            "disturbance 2 3 -5\n"
+                            "disturbance 4 10 1\n"
+                            "scenario b\n"
+                            "hold 2 5\n");
+    std::vector<Scenario> scenarios = parseScenarios(text);
+    ASSERT_EQ(scenarios.size(), 2u);
+
+    const Scenario &a = scenarios[0];
+    EXPECT_EQ(a.name, "a");
+    ASSERT_EQ(a.setpoint.size(), 7u);
+    EXPECT_DOUBLE_EQ(a.setpoint[0], 20.0);
+    EXPECT_DOUBLE_EQ(a.setpoint[3], 50.0);
+    EXPECT_DOUBLE_EQ(a.setpoint[6], 50.0);
+    EXPECT_EQ(a.final_segment_start, 4);
+    EXPECT_EQ(a.mission.noise.distribution, NoiseDistribution::Gaussian);
+    EXPECT_EQ(a.mission.noise.seed, 9u);
+
+    const std::vector<double> disturbance = {0, 0, -5, -5, -4, 1, 1};
+    EXPECT_EQ(a.disturbance, disturbance);
+
+    EXPECT_EQ(scenarios[1].mission.initial_altitude, 0.0);
+    EXPECT_EQ(scenarios[1].setpoint.size(), 2u);
+}
+
+// Test 3: Mistakes are reported with their line number
+TEST(ScenarioTest, ReportsErrors)
+{
+    auto message = [](const std::string &text) {
+        std::istringstream in(text);
+        try
+        {
+            parseScenarios(in);
+        }
+        catch (const std::runtime_error &e)
+        {
+            return std::string(e.what());
+        }
+        return std::string();
+    };
+    EXPECT_EQ(message("hold 10 5\nclimb 3\n"), "line 2: unknown keyword 'climb'");
+    EXPECT_EQ(message("hold -1 5\n"), "line 1: malformed 'hold'");
+    EXPECT_EQ(message("noise pink 0.5\nhold 1 1\n"), "line 1: malformed 'noise'");
+    EXPECT_NE(message("scenario empty\n").find("no hold or ramp"), std::string::npos);
+    EXPECT_EQ(message("scenario a\nhold 1 1\nscenario a\nhold 1 1\n"), "line 3: duplicate scenario 'a'");
+    EXPECT_EQ(message("scenario ../up\nhold 1 1\n"),
+              "line 1: scenario name '../up' may only use letters, digits, '_' and '-'");
+    EXPECT_THROW(loadScenarios("does_not_exist.scn"), std::runtime_error);
+}
+
+// Test 4: A disturbance pushes the vehicle and changes the result
+TEST(ScenarioTest, DisturbanceAffectsFlight)
+{
+    std::istringstream calm("hold 300 100\n"), gusty("hold 300 100\ndisturbance 150 20 -200\n");
+    PIDGains gains = {0.6, 0.01, 0.05};
+    EXPECT_LT(runScenario(gains, parseScenarios(calm)[0]).rmse, runScenario(gains, parseScenarios(gusty)[0]).rmse);
+}
+
+// Test 5: Plant settings select the physics the scenario flies
+TEST(ScenarioTest, PlantKeywords)
+{
+    std::istringstream text("plant vehicle euler\n"
+                            "substeps 8\n"
+                            "vehicle 2.0 0.1 50 0.02 0.1\n"
+                            "hold 300 20\n");
+    Scenario scenario = parseScenarios(text)[0];
+    const PlantConfig &plant = scenario.mission.plant;
+    EXPECT_EQ(plant.type, PlantType::Vehicle);
+    EXPECT_EQ(plant.integrator, IntegratorMethod::SemiImplicitEuler);
+    EXPECT_EQ(plant.substeps, 8);
+    EXPECT_EQ(plant.vehicle.mass, 2.0);
+    EXPECT_EQ(plant.vehicle.motor_tau, 0.1);
+
+    MissionProfile mission = scenario.mission;
+    mission.steps = 300;
+    mission.target1 = mission.target2 = 20.0;
+    mission.switch_step = 0;
+    PIDGains gains = {8.0, 0.05, 25.0};
+    EXPECT_EQ(runScenario(gains, scenario).rmse, simulateMetrics(gains, mission).rmse);
+
+    std::istringstream bad("plant rocket\nhold 10 1\n");
+    EXPECT_THROW(parseScenarios(bad), std::runtime_error);
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "ControlLoop.hpp"
+#include "PID.hpp"
+#include "SensorBase.hpp"
+
+namespace
+{
+    // Minimal static sensor: a noiseless integrator
+    class IdealAltimeter : public SensorBase<IdealAltimeter>
+    {
+    public:
+        double sample() { return _value; }
+        void update(double step_value) { _value += step_value; }
+
+    private:
+        double _value = 0.0;
+    };
+}
+
+static_assert(is_static_sensor_v<MockSensor>, "MockSensor must plug into static loops");
+static_assert(is_static_sensor_v<IdealAltimeter>, "CRTP sensors are detected");
+static_assert(!is_static_sensor_v<PID>, "A controller is not a sensor");
+
+// Test 1: Static and virtual access serve the same stream
+TEST(SensorBaseTest, StaticReadMatchesVirtualRead)
+{
+    MockSensor a(3.0), b(3.0);
+    ISensor &dynamic = a;
+    SensorBase<MockSensor> &fixed = b;
+    for (int i = 0; i < 200; i++)
+        EXPECT_EQ(dynamic.readValue(), fixed.read());
+}
+
+// Test 2: The templated loop accepts any CRTP sensor
+TEST(SensorBaseTest, LoopWithCustomSensor)
+{
+    MissionProfile mission;
+    mission.steps = 400;
+    mission.switch_step = 0;
+
+    PID pid(0.6, 0.01, 0.05, mission.dt, mission.max_output, mission.min_output);
+    IdealAltimeter altimeter;
+    MetricsSummary summary = runControlLoop(pid, altimeter, mission);
+
+    EXPECT_EQ(summary.samples, 400);
+    EXPECT_LT(summary.rmse, 50.0); // Climbs from 0 m towards the 100 m target
+}
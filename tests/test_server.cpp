@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <sstream>
+#include <vector>
+#include "SimulationServer.hpp"
+#include "Simulation.hpp"
+#include "Telemetry.hpp"
+
+// Test 1: A session handles several requests and stops at quit
+TEST(SimulationServerTest, SessionUntilQuit)
+{
+    std::istringstream in("ping\n\nmetrics 0.6 0.01 0.05 100 50 100 30\nquit\nping\n");
+    std::ostringstream out;
+    SimulationServer server;
+    EXPECT_EQ(server.serve(in, out), 3);
+
+    std::istringstream replies(out.str());
+    std::string line;
+    std::getline(replies, line);
+    EXPECT_EQ(line, "ok pong");
+    std::getline(replies, line);
+    EXPECT_EQ(line.rfind("ok ", 0), 0u);
+    EXPECT_FALSE(std::getline(replies, line)); // Nothing after quit
+}
+
+// Test 2: trace streams one row per step and matches the in-process simulation
+TEST(SimulationServerTest, TraceMatchesSimulate)
+{
+    std::istringstream in("trace 0.6 0.01 0.05 20 50 100 10 3\n");
+    std::ostringstream out;
+    SimulationServer().serve(in, out);
+
+    std::istringstream replies(out.str());
+    std::string line;
+    std::getline(replies, line);
+    EXPECT_EQ(line, "ok 20");
+
+    MissionProfile mission;
+    mission.steps = 20;
+    mission.switch_step = 10;
+    mission.noise.seed = 3;
+    MissionTrace expected = simulate({0.6, 0.01, 0.05}, mission);
+
+    for (int i = 0; i < 20; i++)
+    {
+        std::getline(replies, line);
+        double time, target, actual, output;
+        char comma;
+        std::istringstream row(line);
+        row >> time >> comma >> target >> comma >> actual >> comma >> output;
+        EXPECT_NEAR(actual, expected.actual[i], 1e-6);
+    }
+    std::getline(replies, line);
+    EXPECT_EQ(line, "end");
+}
+
+// Test 3: record writes binary telemetry; bad requests report an error and keep the session
+TEST(SimulationServerTest, RecordAndErrors)
+{
+    const std::string path = "test_server_record.bin";
+    std::istringstream in("record " + path + " 0.6 0.01 0.05 50 50 100 10\nmetrics 1 2\nfly\n");
+    std::ostringstream out;
+    EXPECT_EQ(SimulationServer().serve(in, out), 3);
+
+    std::istringstream replies(out.str());
+    std::string line;
+    std::getline(replies, line);
+    EXPECT_EQ(line.rfind("ok ", 0), 0u);
+    std::getline(replies, line);
+    EXPECT_EQ(line.rfind("error metrics", 0), 0u);
+    std::getline(replies, line);
+    EXPECT_EQ(line.rfind("error unknown command", 0), 0u);
+
+    EXPECT_EQ(readBinaryTelemetry(path).actual.size(), 50u);
+    std::remove(path.c_str());
+}
+
+// Test 4: plot downsamples the file but reports full-rate metrics
+TEST(SimulationServerTest, PlotDownsamples)
+{
+    const std::string path = "test_server_plot.bin";
+    std::istringstream in("plot " + path + " 100 0.6 0.01 0.05 1000 50 100 500\nmetrics 0.6 0.01 0.05 1000 50 100 500\n");
+    std::ostringstream out;
+    EXPECT_EQ(SimulationServer().serve(in, out), 2);
+
+    std::istringstream replies(out.str());
+    std::string plotted, full;
+    std::getline(replies, plotted);
+    std::getline(replies, full);
+    EXPECT_EQ(plotted, full);
+
+    EXPECT_LE(readBinaryTelemetry(path).actual.size(), 100u);
+    std::remove(path.c_str());
+}
+
+// Test 5: Repeating a request is answered from the cache with the same reply
+TEST(SimulationServerTest, RepeatedRequestsAreCached)
+{
+    std::istringstream in("metrics 0.6 0.01 0.05 200 50 100 50\nmetrics 0.6 0.01 0.05 200 50 100 50\n"
+                          "metrics 0.6 0.01 0.05 200 50 100 50 7\n");
+    std::ostringstream out;
+    SimulationServer server;
+    EXPECT_EQ(server.serve(in, out), 3);
+
+    std::istringstream replies(out.str());
+    std::string first, second, reseeded;
+    std::getline(replies, first);
+    std::getline(replies, second);
+    std::getline(replies, reseeded);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, reseeded);
+    EXPECT_EQ(server.cacheStats().hits, 1u);
+    EXPECT_EQ(server.cacheStats().misses, 2u);
+}
+
+// Test 6: Traces share one buffer; a shorter run in between does not leak into a repeat
+TEST(SimulationServerTest, TraceBufferReuse)
+{
+    const std::string longer = "trace 0.6 0.01 0.05 30 50 100 10 3\n";
+    std::istringstream in(longer + "trace 0.5 0.01 0.05 12 50 100 6 3\n" + longer + longer);
+    std::ostringstream out;
+    EXPECT_EQ(SimulationServer().serve(in, out), 4);
+
+    std::vector<std::string> replies;
+    std::istringstream lines(out.str());
+    for (std::string reply, line; std::getline(lines, line);)
+    {
+        reply += line + "\n";
+        if (line == "end")
+        {
+            replies.push_back(reply);
+            reply.clear();
+        }
+    }
+    ASSERT_EQ(replies.size(), 4u);
+    EXPECT_EQ(replies[1].rfind("ok 12\n", 0), 0u);
+    EXPECT_EQ(replies[0], replies[2]);
+    EXPECT_EQ(replies[2], replies[3]);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "Simulation.hpp"
+#include "SwarmSimulation.hpp"
+
+namespace
+{
+    SwarmConfig smallSwarm(std::size_t threads)
+    {
+        SwarmConfig config;
+        config.vehicles = 5;
+        config.axes = 3;
+        config.mission.steps = 300;
+        config.mission.switch_step = 100;
+        config.threads = threads;
+        return config;
+    }
+}
+
+// Test 1: Every lane reproduces the scalar simulation with its own seed
+TEST(SwarmSimulationTest, LanesMatchScalarSimulation)
+{
+    SwarmConfig config = smallSwarm(1);
+    SwarmSimulation swarm(config);
+    swarm.run();
+    ASSERT_EQ(swarm.metrics().size(), 15u);
+
+    for (std::size_t l = 0; l < swarm.lanes(); l++)
+    {
+        MissionProfile mission = config.mission;
+        mission.noise.seed = config.mission.noise.seed + l;
+        MetricsSummary expected = simulateMetrics(config.gains, mission);
+        EXPECT_EQ(swarm.metrics()[l].rmse, expected.rmse) << "lane " << l;
+        EXPECT_EQ(swarm.metrics()[l].settling_time, expected.settling_time) << "lane " << l;
+    }
+}
+
+// Test 2: Sharding across threads does not change the results
+TEST(SwarmSimulationTest, ThreadCountDoesNotMatter)
+{
+    SwarmSimulation single(smallSwarm(1)), sharded(smallSwarm(3));
+    single.run();
+    sharded.run();
+    for (std::size_t l = 0; l < single.lanes(); l++)
+        EXPECT_EQ(single.metrics()[l].rmse, sharded.metrics()[l].rmse);
+}
+
+// Test 3: Recorded telemetry has one row per lane and step
+TEST(SwarmSimulationTest, WritesPerVehicleTelemetry)
+{
+    SwarmConfig config = smallSwarm(2);
+    config.record = true;
+    SwarmSimulation swarm(config);
+    swarm.run();
+
+    const std::string path = "test_swarm_telemetry.csv";
+    swarm.writeTelemetryCsv(path);
+
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    EXPECT_EQ(line, "Vehicle,Axis,Time,Target,Actual,Output");
+    int rows = 0;
+    while (std::getline(file, line))
+        rows++;
+    EXPECT_EQ(rows, 5 * 3 * 300);
+    std::remove(path.c_str());
+}
+
+// Test 4: Empty or negative swarms are rejected up front
+TEST(SwarmSimulationTest, RejectsNonPositiveCounts)
+{
+    SwarmConfig config = smallSwarm(2);
+    config.axes = 0;
+    EXPECT_THROW(SwarmSimulation swarm(config), std::invalid_argument);
+    config.axes = 3;
+    config.vehicles = -4;
+    EXPECT_THROW(SwarmSimulation swarm(config), std::invalid_argument);
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include "Sweep.hpp"
+#include "ThreadPool.hpp"
+
+// Test 1: Every submitted task runs exactly once, with or without stealing
+TEST(ThreadPoolTest, RunsEveryTaskOnce)
+{
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallelFor(hits.size(), 7, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++)
+            hits[i]++;
+    });
+    for (const std::atomic<int> &h : hits)
+        EXPECT_EQ(h.load(), 1);
+}
+
+// Test 2: The sweep covers the whole grid and is ranked by cost
+TEST(SweepTest, CoversGridAndRanksByCost)
+{
+    MissionProfile mission;
+    mission.steps = 200;
+    SweepConfig config;
+    config.kp = {0.2, 1.0, 3};
+    config.ki = {0.0, 0.02, 2};
+    config.kd = {0.0, 0.1, 2};
+    config.threads = 2;
+    config.chunk = 5;
+
+    std::vector<SweepResult> results = runSweep(mission, config);
+    ASSERT_EQ(results.size(), 12u);
+    for (std::size_t i = 1; i < results.size(); i++)
+        EXPECT_LE(results[i - 1].cost, results[i].cost);
+}
+
+TEST(SweepTest, GainRangeIncludesBothEnds)
+{
+    GainRange range = {1.0, 2.0, 5};
+    EXPECT_EQ(range.at(0), 1.0);
+    EXPECT_EQ(range.at(4), 2.0);
+    EXPECT_EQ((GainRange{3.0, 9.0, 1}.at(0)), 3.0);
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "Telemetry.hpp"
+
+// Test 1: float64 binary telemetry round-trips exactly, header included
+TEST(TelemetryTest, BinaryRoundTripFloat64)
+{
+    const std::string path = "test_telemetry64.bin";
+    {
+        BinaryTelemetryWriter writer(path, 0.1, 3);
+        for (int i = 0; i < 5; i++) // More rows than expected_steps is fine
+            writer.write({i * 0.1, 50.0, i * 1.1, -i * 0.3});
+    }
+
+    double dt = 0.0;
+    MissionTrace trace = readBinaryTelemetry(path, &dt);
+    EXPECT_EQ(dt, 0.1);
+    ASSERT_EQ(trace.time.size(), 5u);
+    EXPECT_EQ(trace.time[4], 4 * 0.1);
+    EXPECT_EQ(trace.target[2], 50.0);
+    EXPECT_EQ(trace.actual[3], 3 * 1.1);
+    EXPECT_EQ(trace.output[1], -0.3);
+    std::remove(path.c_str());
+}
+
+// Test 2: float32 files keep the layout and lose only precision
+TEST(TelemetryTest, BinaryRoundTripFloat32)
+{
+    const std::string path = "test_telemetry32.bin";
+    {
+        BinaryTelemetryWriter writer(path, 0.1, 2, TelemetryPrecision::Float32);
+        writer.write({0.0, 100.0, 1.0 / 3.0, 12.5});
+        writer.write({0.1, 100.0, 2.0 / 3.0, 7.25});
+    }
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    EXPECT_EQ(static_cast<std::size_t>(file.tellg()), 64u + 4 * 16 + 4 * 2 * sizeof(float));
+
+    MissionTrace trace = readBinaryTelemetry(path);
+    ASSERT_EQ(trace.actual.size(), 2u);
+    EXPECT_EQ(trace.actual[0], static_cast<double>(1.0f / 3.0f));
+    EXPECT_EQ(trace.output[1], 7.25);
+    std::remove(path.c_str());
+}
+
+// Test 3: Reading something that is not a telemetry file throws
+TEST(TelemetryTest, RejectsForeignFiles)
+{
+    const std::string path = "test_telemetry.csv";
+    {
+        CsvTelemetryWriter writer(path);
+        writer.write({0.0, 1.0, 2.0, 3.0});
+    }
+    EXPECT_THROW(readBinaryTelemetry(path), std::runtime_error);
+    EXPECT_THROW(readBinaryTelemetry("does_not_exist.bin"), std::runtime_error);
+    std::remove(path.c_str());
+}
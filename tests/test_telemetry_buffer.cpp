@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <new>
+#include "TelemetryBuffer.hpp"
+
+// Counts heap allocations made by this thread while g_counting is set.
+// Replacing the global operator new applies to the whole test binary, so it
+// only counts inside the measured blocks.
+namespace
+{
+    thread_local bool g_counting = false;
+    thread_local std::size_t g_allocations = 0;
+
+    template <typename F>
+    std::size_t countAllocations(F &&body)
+    {
+        g_allocations = 0;
+        g_counting = true;
+        body();
+        g_counting = false;
+        return g_allocations;
+    }
+}
+
+void *operator new(std::size_t size)
+{
+    if (g_counting)
+        g_allocations++;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+void *operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+// Test 1: Buffered simulation matches the vector-based trace
+TEST(TelemetryBufferTest, MatchesSimulate)
+{
+    MissionProfile mission;
+    PIDGains gains = {0.6, 0.01, 0.05};
+    MissionTrace expected = simulate(gains, mission);
+
+    TelemetryBuffer buffer;
+    simulate(gains, mission, buffer);
+    ASSERT_EQ(buffer.size(), expected.actual.size());
+    for (std::size_t i = 0; i < buffer.size(); i++)
+    {
+        EXPECT_EQ(buffer.time()[i], expected.time[i]);
+        EXPECT_EQ(buffer.actual()[i], expected.actual[i]);
+        EXPECT_EQ(buffer.output()[i], expected.output[i]);
+    }
+}
+
+// Test 2: A reused buffer never allocates again, and the whole run is allocation-free
+TEST(TelemetryBufferTest, ReuseIsAllocationFree)
+{
+    MissionProfile mission;
+    TelemetryBuffer buffer(mission.steps);
+    EXPECT_EQ(buffer.allocations(), 1u);
+
+    std::size_t allocations = countAllocations([&]() {
+        for (int run = 0; run < 10; run++)
+            simulate({0.6 + run * 0.01, 0.01, 0.05}, mission, buffer);
+    });
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(buffer.allocations(), 1u);
+    EXPECT_EQ(buffer.size(), static_cast<std::size_t>(mission.steps));
+
+    // Shorter runs fit too; longer ones grow the arena once
+    mission.steps = 2000;
+    simulate({0.6, 0.01, 0.05}, mission, buffer);
+    simulate({0.6, 0.01, 0.05}, mission, buffer);
+    EXPECT_EQ(buffer.allocations(), 2u);
+}
+
+// Test 3: Metrics-only runs (tuner, bounded runs) never touch the heap
+TEST(TelemetryBufferTest, MetricsRunsAllocateNothing)
+{
+    MissionProfile mission;
+    std::size_t allocations = countAllocations([&]() {
+        simulateMetrics({0.6, 0.01, 0.05}, mission);
+        simulateBounded({0.6, 0.01, 0.05}, mission, divergenceLimits());
+    });
+    EXPECT_EQ(allocations, 0u);
+}
+
+// Test 4: Batched runs only allocate during setup, never per step
+TEST(TelemetryBufferTest, BatchLoopAllocatesOnlyInSetup)
+{
+    std::vector<PIDGains> candidates(8, PIDGains{0.6, 0.01, 0.05});
+    MissionProfile short_mission, long_mission;
+    short_mission.steps = 100;
+    long_mission.steps = 10000;
+
+    std::size_t short_run = countAllocations([&]() { simulateBatch(candidates, short_mission); });
+    std::size_t long_run = countAllocations([&]() { simulateBatch(candidates, long_mission); });
+    EXPECT_GT(short_run, 0u); // The counter is live
+    EXPECT_EQ(short_run, long_run);
+}
+
+// Test 5: Records past the capacity are dropped, not grown into
+TEST(TelemetryBufferTest, FullBufferDrops)
+{
+    TelemetryBuffer buffer(2);
+    for (int i = 0; i < 5; i++)
+        buffer.write({i * 1.0, 0.0, 0.0, 0.0});
+    EXPECT_EQ(buffer.size(), 2u);
+    EXPECT_EQ(buffer.dropped(), 3u);
+    EXPECT_EQ(buffer.toTrace().time.back(), 1.0);
+
+    buffer.reset(); // A reused buffer reports only its own run's drops
+    EXPECT_EQ(buffer.dropped(), 0u);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "TelemetryDownsampler.hpp"
+
+namespace
+{
+    // Keeps what reaches the file
+    class CaptureWriter : public TelemetryWriter
+    {
+    public:
+        explicit CaptureWriter(std::vector<TelemetryRecord> &out) : _out(out) {}
+        void write(const TelemetryRecord &record) override { _out.push_back(record); }
+        void close() override {}
+
+    private:
+        std::vector<TelemetryRecord> &_out;
+    };
+
+    std::vector<TelemetryRecord> run(std::size_t steps, std::size_t max_points, DownsampleMode mode)
+    {
+        std::vector<TelemetryRecord> out;
+        DownsamplingTelemetryWriter writer(std::make_unique<CaptureWriter>(out), steps, max_points, mode);
+        for (std::size_t i = 0; i < steps; i++)
+            writer.write({i * 0.1, 100.0, (i == 12345) ? 150.0 : 100.0 * std::sin(i * 0.001), 0.0});
+        writer.close();
+        return out;
+    }
+}
+
+// Test 1: A 1M-step run fits the point budget and keeps its time order
+TEST(TelemetryDownsamplerTest, MinMaxRespectsBudget)
+{
+    std::vector<TelemetryRecord> out = run(1000000, 2000, DownsampleMode::MinMax);
+    EXPECT_LE(out.size(), 2000u);
+    EXPECT_GT(out.size(), 1900u);
+    for (std::size_t i = 1; i < out.size(); i++)
+        EXPECT_LT(out[i - 1].time, out[i].time);
+}
+
+// Test 2: A single-step spike survives MinMax but not plain decimation
+TEST(TelemetryDownsamplerTest, MinMaxKeepsPeaks)
+{
+    auto peak = [](const std::vector<TelemetryRecord> &records) {
+        double best = -1e9;
+        for (const TelemetryRecord &r : records)
+            best = std::max(best, r.actual);
+        return best;
+    };
+    const double spike = 150.0;
+    EXPECT_DOUBLE_EQ(peak(run(100000, 1000, DownsampleMode::MinMax)), spike);
+    EXPECT_LT(peak(run(100000, 1000, DownsampleMode::Decimate)), spike);
+}
+
+// Test 3: Decimation keeps every stride-th record, starting with the first
+TEST(TelemetryDownsamplerTest, DecimateStride)
+{
+    std::vector<TelemetryRecord> out = run(1000, 100, DownsampleMode::Decimate);
+    ASSERT_EQ(out.size(), 100u);
+    for (std::size_t i = 0; i < out.size(); i++)
+        EXPECT_DOUBLE_EQ(out[i].time, (i * 10) * 0.1);
+}
+
+// Test 4: Short runs and a zero budget pass through untouched
+TEST(TelemetryDownsamplerTest, PassThrough)
+{
+    EXPECT_EQ(run(500, 2000, DownsampleMode::MinMax).size(), 500u);
+    EXPECT_EQ(run(500, 0, DownsampleMode::MinMax).size(), 500u);
+}
+
+// Test 5: Even the smallest budgets are never exceeded
+TEST(TelemetryDownsamplerTest, TinyBudgets)
+{
+    for (std::size_t max_points = 1; max_points <= 5; max_points++)
+    {
+        EXPECT_LE(run(1000, max_points, DownsampleMode::MinMax).size(), max_points) << max_points;
+        EXPECT_LE(run(1000, max_points, DownsampleMode::Decimate).size(), max_points) << max_points;
+    }
+    EXPECT_EQ(run(1000, 1, DownsampleMode::MinMax)[0].time, 0.0); // The first record
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "SpscRing.hpp"
+#include "TelemetrySink.hpp"
+
+namespace
+{
+    // Collects everything it receives, optionally slowly, to exercise the ring
+    class RecordingWriter : public TelemetryWriter
+    {
+    public:
+        explicit RecordingWriter(std::vector<TelemetryRecord> &out, bool slow = false) : _out(out), _slow(slow) {}
+        void write(const TelemetryRecord &record) override
+        {
+            if (_slow)
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            _out.push_back(record);
+        }
+        void close() override {}
+
+    private:
+        std::vector<TelemetryRecord> &_out;
+        bool _slow;
+    };
+}
+
+// Test 1: The ring holds exactly its (power of two) capacity
+TEST(SpscRingTest, CapacityAndOrder)
+{
+    SpscRing<int> ring(6); // Rounded up to 8
+    EXPECT_EQ(ring.capacity(), 8u);
+    for (int i = 0; i < 8; i++)
+        EXPECT_TRUE(ring.tryPush(i));
+    EXPECT_FALSE(ring.tryPush(8));
+
+    int out[8];
+    ASSERT_EQ(ring.popBulk(out, 8), 8u);
+    for (int i = 0; i < 8; i++)
+        EXPECT_EQ(out[i], i);
+}
+
+// Test 2: Under backpressure nothing is lost and order is preserved
+TEST(TelemetrySinkTest, BlockPolicyKeepsEveryRecord)
+{
+    std::vector<TelemetryRecord> received;
+    {
+        TelemetrySink sink(std::make_unique<RecordingWriter>(received), 16, OverflowPolicy::Block, 4);
+        for (int i = 0; i < 5000; i++)
+            sink.write({i * 0.1, 1.0, 2.0, 3.0});
+        sink.close();
+
+        TelemetrySinkStats stats = sink.stats();
+        EXPECT_EQ(stats.pushed, 5000u);
+        EXPECT_EQ(stats.written, 5000u);
+        EXPECT_EQ(stats.dropped, 0u);
+    }
+    ASSERT_EQ(received.size(), 5000u);
+    for (int i = 0; i < 5000; i++)
+        ASSERT_EQ(received[i].time, i * 0.1);
+}
+
+// Test 3: The drop policy never waits, and every record is accounted for
+TEST(TelemetrySinkTest, DropPolicyCountsOverruns)
+{
+    std::vector<TelemetryRecord> received;
+    TelemetrySink sink(std::make_unique<RecordingWriter>(received, true), 8, OverflowPolicy::Drop, 2);
+    for (int i = 0; i < 2000; i++)
+        sink.write({i * 1.0, 0.0, 0.0, 0.0});
+    sink.close();
+
+    TelemetrySinkStats stats = sink.stats();
+    EXPECT_GT(stats.dropped, 0u);
+    EXPECT_EQ(stats.pushed + stats.dropped, 2000u);
+    EXPECT_EQ(stats.written, stats.pushed);
+    EXPECT_EQ(received.size(), stats.written);
+}
+
+// Test 4: Records written after close() are dropped, not left in the ring as pushed
+TEST(TelemetrySinkTest, WriteAfterCloseDrops)
+{
+    std::vector<TelemetryRecord> received;
+    TelemetrySink sink(std::make_unique<RecordingWriter>(received), 16);
+    sink.write({0.0, 0.0, 0.0, 0.0});
+    sink.close();
+    sink.write({1.0, 0.0, 0.0, 0.0});
+    sink.write({2.0, 0.0, 0.0, 0.0});
+
+    TelemetrySinkStats stats = sink.stats();
+    EXPECT_EQ(stats.pushed, 1u);
+    EXPECT_EQ(stats.written, 1u);
+    EXPECT_EQ(stats.dropped, 2u);
+    EXPECT_EQ(received.size(), 1u);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Tuner.hpp"
+
+// Test 1: The in-process simulation records one sample per step
+TEST(TunerTest, SimulationRecordsEveryStep)
+{
+    MissionProfile mission;
+    mission.steps = 200;
+    MissionTrace trace = simulate({0.6, 0.01, 0.05}, mission);
+    ASSERT_EQ(trace.actual.size(), 200u);
+    EXPECT_EQ(trace.target.front(), mission.target1);
+    EXPECT_EQ(trace.target.back(), mission.target1); // switch_step (500) is never reached
+}
+
+// Test 2: Twiddle should never return something worse than its starting point
+TEST(TunerTest, TunedCostNotWorseThanInitial)
+{
+    MissionProfile mission;
+    mission.steps = 500;
+    mission.target1 = 100.0;
+    mission.target2 = 100.0;
+    mission.switch_step = 0;
+
+    TunerConfig config;
+    Tuner tuner(mission, config);
+    double initial_cost = tuner.evaluate({config.initial[0], config.initial[1], config.initial[2]});
+
+    TuningResult result = tuner.run();
+    EXPECT_LE(result.cost, initial_cost);
+    EXPECT_GT(result.evaluations, 1);
+    EXPECT_GE(result.gains.kp, 0.0);
+}
+
+// Test 3: Evaluating the same gains twice gives the same cost
+TEST(TunerTest, EvaluationIsRepeatable)
+{
+    MissionProfile mission;
+    TunerConfig config;
+    config.strategy = TuningStrategy::Balanced;
+    Tuner tuner(mission, config);
+    EXPECT_EQ(tuner.evaluate({0.6, 0.01, 0.05}), tuner.evaluate({0.6, 0.01, 0.05}));
+}
+
+// Test 4: Early termination finds the same gains while simulating fewer steps
+TEST(TunerTest, EarlyTerminationKeepsResult)
+{
+    MissionProfile mission;
+    for (TuningStrategy strategy : {TuningStrategy::Accuracy, TuningStrategy::Balanced})
+    {
+        TunerConfig config;
+        config.strategy = strategy;
+        Tuner bounded(mission, config);
+        TuningResult fast = bounded.run();
+
+        config.early_termination = false;
+        Tuner full(mission, config);
+        TuningResult slow = full.run();
+
+        EXPECT_EQ(fast.gains.kp, slow.gains.kp);
+        EXPECT_EQ(fast.gains.ki, slow.gains.ki);
+        EXPECT_EQ(fast.gains.kd, slow.gains.kd);
+        EXPECT_EQ(fast.cost, slow.cost);
+        EXPECT_EQ(fast.evaluations + fast.cache_hits, slow.evaluations + slow.cache_hits);
+        EXPECT_LE(bounded.simulatedSteps(), full.simulatedSteps());
+        if (strategy == TuningStrategy::Accuracy) // Balanced bounds are loose: the cost includes the settling penalty
+        {
+            EXPECT_GT(fast.aborted, 0);
+            EXPECT_LT(bounded.simulatedSteps(), full.simulatedSteps());
+        }
+    }
+}
+
+// Test 5: A run that pins the output at its limit is flagged as diverged
+TEST(TunerTest, DivergenceStopsRun)
+{
+    MissionProfile mission;
+    RunLimits limits = divergenceLimits();
+
+    // Negative gain pushes away from the target until it is railed
+    RunResult runaway = simulateBounded({-1.0, 0.0, 0.0}, mission, limits);
+    EXPECT_EQ(runaway.status, RunStatus::Diverged);
+    EXPECT_LT(runaway.steps, mission.steps);
+
+    RunResult healthy = simulateBounded({0.6, 0.01, 0.05}, mission, limits);
+    EXPECT_EQ(healthy.status, RunStatus::Completed);
+    EXPECT_EQ(healthy.steps, mission.steps);
+    EXPECT_EQ(healthy.metrics.rmse, simulateMetrics({0.6, 0.01, 0.05}, mission).rmse);
+
+    // A bound below the final RMSE stops it partway
+    RunLimits tight;
+    tight.rmse_bound = healthy.metrics.rmse * 0.5;
+    RunResult bounded = simulateBounded({0.6, 0.01, 0.05}, mission, tight);
+    EXPECT_EQ(bounded.status, RunStatus::CostBound);
+    EXPECT_LT(bounded.steps, mission.steps);
+}
+
+// Test 6: A full-run result in a shared cache never turns a diverging candidate finite
+TEST(TunerTest, SharedCacheRespectsDivergenceLimits)
+{
+    MissionProfile mission;
+    mission.steps = 300;
+    ResultCache cache(64);
+    const PIDGains runaway = {-1.0, 0.0, 0.0}; // Pushes the wrong way until it rails
+
+    TunerConfig unlimited;
+    unlimited.early_termination = false;
+    unlimited.cache = &cache;
+    EXPECT_TRUE(std::isfinite(Tuner(mission, unlimited).evaluate(runaway)));
+
+    TunerConfig bounded;
+    bounded.cache = &cache;
+    Tuner tuner(mission, bounded);
+    EXPECT_TRUE(std::isinf(tuner.evaluate(runaway)));
+    EXPECT_TRUE(std::isinf(tuner.evaluate(runaway))); // Diverged runs are not cached either
+    EXPECT_EQ(tuner.evaluate({0.6, 0.01, 0.05}), Tuner(mission, bounded).evaluate({0.6, 0.01, 0.05}));
+}
+
+// Test 7: A setpoint far from the start is a big step, not a runaway
+TEST(TunerTest, HighAltitudeTargetIsNotDivergence)
+{
+    MissionProfile mission;
+    mission.target1 = mission.target2 = 1500.0;
+    mission.switch_step = 0;
+    RunResult climb = simulateBounded({0.6, 0.01, 0.05}, mission, divergenceLimits());
+    EXPECT_EQ(climb.status, RunStatus::Completed);
+    EXPECT_EQ(climb.steps, mission.steps);
+
+    TuningResult result = Tuner(mission, TunerConfig()).run();
+    EXPECT_TRUE(std::isfinite(result.cost));
+}
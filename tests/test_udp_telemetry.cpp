@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include "UdpTelemetry.hpp"
+
+namespace
+{
+    // UDP socket bound to an ephemeral loopback port
+    struct Listener
+    {
+        int fd;
+        std::uint16_t port;
+
+        Listener() : fd(socket(AF_INET, SOCK_DGRAM, 0)), port(0)
+        {
+            sockaddr_in addr;
+            std::memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+            socklen_t len = sizeof(addr);
+            getsockname(fd, reinterpret_cast<sockaddr *>(&addr), &len);
+            port = ntohs(addr.sin_port);
+
+            timeval timeout = {1, 0};
+            setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        }
+        ~Listener() { close(fd); }
+
+        // Returns an empty packet on timeout
+        std::vector<unsigned char> receive()
+        {
+            std::vector<unsigned char> packet(2048);
+            ssize_t n = recv(fd, packet.data(), packet.size(), 0);
+            packet.resize(n > 0 ? static_cast<std::size_t>(n) : 0);
+            return packet;
+        }
+    };
+}
+
+// Test 1: Decimated records arrive in sequenced packets, the last one flagged
+TEST(UdpTelemetryTest, PublishesDecimatedPackets)
+{
+    Listener listener;
+    UdpTelemetryPublisher publisher("127.0.0.1", listener.port, 2);
+    for (int i = 0; i < 100; i++)
+        publisher.write({i * 0.1, 50.0, static_cast<double>(i), -static_cast<double>(i)});
+    publisher.close();
+
+    // 50 published records: one full packet of 32, then 18 in the last packet
+    std::vector<double> times;
+    std::uint32_t expected_sequence = 0;
+    bool last = false;
+    while (!last)
+    {
+        std::vector<unsigned char> packet = listener.receive();
+        ASSERT_GE(packet.size(), sizeof(TelemetryPacketHeader));
+
+        TelemetryPacketHeader header;
+        std::memcpy(&header, packet.data(), sizeof(header));
+        EXPECT_EQ(std::memcmp(header.magic, "ATLP", 4), 0);
+        EXPECT_EQ(header.version, UdpTelemetryPublisher::kVersion);
+        EXPECT_EQ(header.sequence, expected_sequence++);
+        EXPECT_EQ(header.decimation, 2);
+        ASSERT_EQ(packet.size(), sizeof(header) + header.count * 4 * sizeof(double));
+
+        for (std::uint16_t r = 0; r < header.count; r++)
+        {
+            double values[4];
+            std::memcpy(values, packet.data() + sizeof(header) + r * sizeof(values), sizeof(values));
+            times.push_back(values[0]);
+            EXPECT_EQ(values[3], -values[2]);
+        }
+        last = (header.flags & UdpTelemetryPublisher::kFlagLast) != 0;
+    }
+
+    ASSERT_EQ(times.size(), 50u);
+    for (std::size_t i = 0; i < times.size(); i++)
+        EXPECT_DOUBLE_EQ(times[i], (2 * i) * 0.1);
+    EXPECT_EQ(publisher.stats().packets, 2u);
+    EXPECT_EQ(publisher.stats().records, 50u);
+}
+
+// Test 2: Address parsing
+TEST(UdpTelemetryTest, ParsesHostPort)
+{
+    std::string host;
+    std::uint16_t port = 0;
+    EXPECT_TRUE(parseHostPort("239.0.0.1:14550", host, port));
+    EXPECT_EQ(host, "239.0.0.1");
+    EXPECT_EQ(port, 14550);
+    EXPECT_FALSE(parseHostPort("localhost", host, port));
+    EXPECT_FALSE(parseHostPort("localhost:0", host, port));
+    EXPECT_FALSE(parseHostPort(":14550", host, port));
+    EXPECT_FALSE(parseHostPort("localhost:port", host, port));
+}
+
+// Test 3: A decimation the packet header cannot carry is rejected, not truncated
+TEST(UdpTelemetryTest, RejectsOversizedDecimation)
+{
+    EXPECT_THROW(UdpTelemetryPublisher("127.0.0.1", 14550, 65536), std::invalid_argument);
+    UdpTelemetryPublisher largest("127.0.0.1", 14550, 65535);
+    largest.close();
+}